@@ -25,7 +25,7 @@
 
 namespace EmiROOT {
 
-  enum Algo {ABC, BAT, CS, GA, GSA, GWO, HS, IHS, MFO, PS, SA, WOA}
+  enum Algo {ABC, BAT, CMAES, CS, DE, GA, GSA, GWO, HS, IHS, MFO, PS, SA, WOA}
 
   class Fitter {
 
@@ -0,0 +1,251 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+*/
+
+
+#include "Algorithms.h"
+#include <ABC/ABC_algorithm.h>
+#include <BAT/BAT_algorithm.h>
+#include <CC/CC_algorithm.h>
+#include <CMAES/CMAES_algorithm.h>
+#include <CS/CS_algorithm.h>
+#include <DE/DE_algorithm.h>
+#include <GA/GA_algorithm.h>
+#include <GSA/GSA_algorithm.h>
+#include <GWO/GWO_algorithm.h>
+#include <HS/HS_algorithm.h>
+#include <IHS/IHS_algorithm.h>
+#include <MFO/MFO_algorithm.h>
+#include <PS/PS_algorithm.h>
+#include <PS/PSFixed_algorithm.h>
+#include <SA/SA_algorithm.h>
+#include <WOA/WOA_algorithm.h>
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+using namespace EmiROOT;
+using namespace EmiROOT::Bench;
+
+namespace {
+
+  // Parameters of the simulated annealing inner loops, kept small so
+  // that an iteration does not consume the whole evaluation budget
+  const std::size_t kSANs = 5;
+  const std::size_t kSANt = 2;
+
+  /// Fraction of the GA population kept at each generation; only the
+  /// offspring replacing the others are evaluated again
+  const double kGAKeepFraction = 0.4;
+
+  /// Initial population size of L-SHADE, which shrinks to 4 individuals
+  std::size_t lshadePopulationSize(std::size_t d) {
+    return 18*d;
+  }
+
+  /// Default population size of CMA-ES, which is much smaller than the
+  /// one of the other algorithms
+  std::size_t cmaesPopulationSize(std::size_t d) {
+    return 4 + (std::size_t) std::floor(3.*std::log((double) d));
+  }
+
+  /// Set the parameters common to every configuration
+  void setCommon(Config& config, std::size_t pop_size, std::size_t n_iter, std::size_t max_evaluations) {
+    config.setPopulationSize(pop_size);
+    config.setNMaxIterations(n_iter);
+    config.setMaxEvaluations(max_evaluations);
+    // never stop because of iterations at the same cost: the benchmark
+    // compares algorithms at a fixed budget
+    config.setNMaxIterationsAtSameCost(n_iter);
+    config.setAbsoluteTol(0.);
+  }
+
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::vector<std::string> Bench::getAlgorithmNames() {
+  return {"ABC", "BAT", "CMAES", "CS", "DE", "GA", "GSA", "GWO", "HS", "IHS", "LSHADE", "MFO", "PS", "PSFixed", "SA", "SHADE", "WOA"};
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+double Bench::getEvaluationsPerIteration(const std::string& name, std::size_t pop_size, std::size_t d) {
+  double n = pop_size;
+  if (name == "HS" || name == "IHS") return 1.;
+  if (name == "CS") return 1. + std::round(0.25*n);
+  if (name == "ABC") return n - 1.;
+  if (name == "GA") return n - std::floor(kGAKeepFraction*n);
+  if (name == "CC") return (double) CCConfig().getGroupBudget()*d;
+  if (name == "CMAES") return cmaesPopulationSize(d);
+  if (name == "LSHADE") {
+    // The population shrinks linearly with the evaluations used, hence
+    // about exponentially with the iterations
+    double n0 = lshadePopulationSize(d);
+    return (n0 - 4.)/std::log(n0/4.);
+  }
+  if (name == "SA") return kSANs*kSANt*n*d;
+  return n;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::unique_ptr<Algorithm> Bench::makeAlgorithm(const std::string& name, const Function& f, const RunSettings& settings, std::size_t d) {
+  std::size_t n = settings.population_size;
+  double per_iter = getEvaluationsPerIteration(name, n, d);
+  // Rounded up, and counting at most the smallest initial population, so
+  // that the budget of evaluations ends every run
+  std::size_t n_init = n;
+  if (name == "LSHADE") n_init = std::min(n, lshadePopulationSize(d));
+  if (name == "CMAES") n_init = std::min(n, cmaesPopulationSize(d));
+  std::size_t n_iter = std::max<std::size_t>(2, (std::size_t) std::ceil((settings.max_evaluations - n_init)/per_iter) + 1);
+  double range = settings.range;
+
+  std::unique_ptr<Algorithm> algo;
+
+  if (name == "ABC") {
+    ABCConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    config.setEmployedFraction(0.5);
+    config.setNScoutBees(1);
+    algo.reset(new ABC_algorithm(f, config));
+  } else if (name == "BAT") {
+    BATConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    config.setInitialLoudness(1.5);
+    config.setAlpha(0.9);
+    config.setInitialPulseRate(0.5);
+    config.setGamma(0.9);
+    config.setMinFrequency(0.);
+    config.setMaxFrequency(2.);
+    algo.reset(new BAT_algorithm(f, config));
+  } else if (name == "CC") {
+    // SHADE on the groups found by differential grouping
+    DEConfig group_config;
+    group_config.setPopulationSize(20);
+    group_config.setStrategy(CURRENT_TO_PBEST_1);
+    group_config.setAdaptive(true);
+    group_config.setArchiveRate(1.);
+    group_config.setNMaxIterationsAtSameCost(settings.max_evaluations);
+    group_config.setAbsoluteTol(0.);
+    CCConfig config;
+    setCommon(config, 1, n_iter, settings.max_evaluations);
+    config.setOptimizer(makeCCOptimizer<DE_algorithm>(group_config));
+    config.setGrouping(DIFFERENTIAL_GROUPING);
+    algo.reset(new CC_algorithm(f, config));
+  } else if (name == "CMAES") {
+    CMAESConfig config;
+    setCommon(config, cmaesPopulationSize(d), n_iter, settings.max_evaluations);
+    algo.reset(new CMAES_algorithm(f, config));
+  } else if (name == "CS") {
+    CSConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    config.setPa(0.25);
+    config.setAlpha(0.01*range);
+    algo.reset(new CS_algorithm(f, config));
+  } else if (name == "DE") {
+    DEConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    config.setStrategy(RAND_1);
+    config.setF(0.5);
+    config.setCR(0.9);
+    algo.reset(new DE_algorithm(f, config));
+  } else if (name == "SHADE" || name == "LSHADE") {
+    DEConfig config;
+    config.setStrategy(CURRENT_TO_PBEST_1);
+    config.setAdaptive(true);
+    if (name == "SHADE") {
+      setCommon(config, n, n_iter, settings.max_evaluations);
+      config.setArchiveRate(1.);
+    } else {
+      setCommon(config, lshadePopulationSize(d), n_iter, settings.max_evaluations);
+      config.setMinPopulationSize(4);
+    }
+    algo.reset(new DE_algorithm(f, config));
+  } else if (name == "GA") {
+    GAConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    config.setKeepFraction(kGAKeepFraction);
+    config.setMutationRate(0.1);
+    algo.reset(new GA_algorithm(f, config));
+  } else if (name == "GSA") {
+    GSAConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    config.setGrav(1000.);
+    config.setGravEvolution(20.);
+    algo.reset(new GSA_algorithm(f, config));
+  } else if (name == "GWO") {
+    GWOConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    algo.reset(new GWO_algorithm(f, config));
+  } else if (name == "HS") {
+    HSConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    config.setHmcr(0.95);
+    config.setPar(0.3);
+    config.setBw(0.01*range);
+    algo.reset(new HS_algorithm(f, config));
+  } else if (name == "IHS") {
+    IHSConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    config.setHmcr(0.95);
+    config.setParMin(0.3);
+    config.setParMax(0.99);
+    config.setBwMin(1.e-5*range);
+    config.setBwMax(0.05*range);
+    algo.reset(new IHS_algorithm(f, config));
+  } else if (name == "MFO") {
+    MFOConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    algo.reset(new MFO_algorithm(f, config));
+  } else if (name == "PS" || name == "PSFixed") {
+    PSConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    config.setAlpha({0.5});
+    config.setAlphaEvolution(1.);
+    config.setCognitiveParameter(1.5);
+    config.setSocialParameter(1.5);
+    config.setInertia(0.9);
+    if (name == "PS") {
+      algo.reset(new PS_algorithm(f, config));
+    } else {
+      // Specialisation on the dimension, up to PSFixedMaxDimension
+      algo = makePSAlgorithm(f, config, d);
+    }
+  } else if (name == "SA") {
+    SAConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    config.setT0(1000.);
+    config.setNs(kSANs);
+    config.setNt(kSANt);
+    config.setC(2);
+    config.setRt(0.85);
+    config.setWmin(0.25);
+    config.setWmax(1.25);
+    config.setRouletteWheel();
+    algo.reset(new SA_algorithm(f, config));
+  } else if (name == "WOA") {
+    WOAConfig config;
+    setCommon(config, n, n_iter, settings.max_evaluations);
+    algo.reset(new WOA_algorithm(f, config));
+  } else {
+    throw std::invalid_argument("Unknown algorithm " + name);
+  }
+
+  algo->setAlgoName(name);
+  return algo;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
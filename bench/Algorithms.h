@@ -0,0 +1,54 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+*/
+
+
+#ifndef EmiROOT_BenchAlgorithms_h
+#define EmiROOT_BenchAlgorithms_h
+
+#include <Base/Algorithm.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace EmiROOT {
+
+  namespace Bench {
+
+    /// Settings shared by all the algorithms of a benchmark run
+    struct RunSettings {
+      std::size_t population_size;
+      std::size_t max_evaluations; /**< Evaluation budget, enforced with Config::setMaxEvaluations */
+      double      range;           /**< Width of the search domain, used to scale step sizes */
+    };
+
+    /// Return the names of all the algorithms in the library, except CC:
+    /// its cycles build a new algorithm for each group, so it allocates at
+    /// every iteration, and it can be selected by name
+    std::vector<std::string> getAlgorithmNames();
+
+    /// Return the expected number of objective evaluations per iteration
+    double getEvaluationsPerIteration(const std::string&, std::size_t pop_size, std::size_t d);
+
+    /// Create an algorithm configured with the library default parameters.
+    /// The run stops when the evaluation budget is exhausted; the number of
+    /// iterations, which drives the parameter schedules, is chosen to match it.
+    std::unique_ptr<Algorithm> makeAlgorithm(const std::string&, const Function&, const RunSettings&, std::size_t d);
+
+  }
+
+}
+#endif
@@ -0,0 +1,99 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+*/
+
+
+#ifndef EmiROOT_JsonWriter_h
+#define EmiROOT_JsonWriter_h
+
+#include <cmath>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace EmiROOT {
+
+  namespace Bench {
+
+    /// Minimal streaming JSON writer, enough to dump benchmark records
+    class JsonWriter {
+    public:
+      JsonWriter(std::ostream& os) : m_os(os), m_first(1, true) {
+        m_os << std::setprecision(10);
+      }
+
+      void beginObject() {separator(); m_os << "{"; m_first.push_back(true);}
+
+      void endObject() {m_first.pop_back(); m_os << "}";}
+
+      void beginArray() {separator(); m_os << "["; m_first.push_back(true);}
+
+      void endArray() {m_first.pop_back(); m_os << "]";}
+
+      /// Write the key of the next member of an object
+      void key(const std::string& t) {
+        separator();
+        writeString(t);
+        m_os << ":";
+        m_first.back() = true;
+      }
+
+      void value(const std::string& t) {separator(); writeString(t);}
+
+      void value(const char* t) {value(std::string(t));}
+
+      void value(bool t) {separator(); m_os << (t ? "true" : "false");}
+
+      void value(double t) {
+        separator();
+        if (std::isfinite(t)) {
+          m_os << t;
+        } else {
+          m_os << "null";
+        }
+      }
+
+      void value(std::size_t t) {separator(); m_os << t;}
+
+      void null() {separator(); m_os << "null";}
+
+      template<typename T>
+      void member(const std::string& k, const T& t) {key(k); value(t);}
+
+    private:
+      void separator() {
+        if (!m_first.back()) m_os << ",";
+        m_first.back() = false;
+      }
+
+      void writeString(const std::string& t) {
+        m_os << "\"";
+        for (char c : t) {
+          if (c == '"' || c == '\\') m_os << '\\';
+          m_os << c;
+        }
+        m_os << "\"";
+      }
+
+      std::ostream&     m_os;
+      std::vector<bool> m_first; /**< True if nothing was written yet at the current nesting level */
+    };
+
+  }
+
+}
+#endif
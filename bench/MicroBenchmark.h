@@ -0,0 +1,95 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+*/
+
+
+#ifndef EmiROOT_MicroBenchmark_h
+#define EmiROOT_MicroBenchmark_h
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+#include <vector>
+
+namespace EmiROOT {
+
+  namespace Bench {
+
+    /// Statistics of the time per operation of a kernel
+    struct Measurement {
+      std::string name;
+      std::size_t ops_per_sample; /**< Number of calls timed together in a sample */
+      std::size_t samples;        /**< Number of samples */
+      double      median_ns;
+      double      mean_ns;
+      double      stddev_ns;
+      double      min_ns;
+    };
+
+    /// Sink used to keep the compiler from optimizing away the result of a kernel
+    inline void doNotOptimize(double t) {
+      static volatile double sink;
+      sink = t;
+    }
+
+    /// Time a kernel. The number of calls per sample is calibrated so that a
+    /// sample lasts at least min_sample_time seconds, which makes the clock
+    /// resolution negligible; the statistics are computed over the samples.
+    template<typename F>
+    Measurement measure(const std::string& name, F&& kernel, std::size_t samples = 21, double min_sample_time = 2.e-3) {
+      using Clock = std::chrono::steady_clock;
+
+      // warm-up and calibration
+      std::size_t ops = 1;
+      while (true) {
+        auto t0 = Clock::now();
+        for (std::size_t i = 0; i < ops; ++i) kernel();
+        double elapsed = std::chrono::duration<double>(Clock::now() - t0).count();
+        if (elapsed >= min_sample_time || ops >= (std::size_t(1) << 30)) break;
+        ops *= 2;
+      }
+
+      std::vector<double> t(samples);
+      for (std::size_t s = 0; s < samples; ++s) {
+        auto t0 = Clock::now();
+        for (std::size_t i = 0; i < ops; ++i) kernel();
+        t[s] = 1.e9*std::chrono::duration<double>(Clock::now() - t0).count()/ops;
+      }
+
+      Measurement m;
+      m.name           = name;
+      m.ops_per_sample = ops;
+      m.samples        = samples;
+
+      double sum = 0., sum2 = 0.;
+      for (double x : t) {
+        sum  += x;
+        sum2 += x*x;
+      }
+      m.mean_ns   = sum/samples;
+      m.stddev_ns = samples > 1 ? std::sqrt(std::max(0., (sum2 - sum*sum/samples)/(samples - 1))) : 0.;
+
+      std::sort(t.begin(), t.end());
+      m.min_ns    = t.front();
+      m.median_ns = samples % 2 ? t[samples/2] : 0.5*(t[samples/2 - 1] + t[samples/2]);
+      return m;
+    }
+
+  }
+
+}
+#endif
@@ -0,0 +1,240 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+*/
+
+
+#include "TestFunctions.h"
+#include <Base/Random.h>
+#include <Base/Utility.h>
+#include <math.h>
+
+using namespace EmiROOT;
+using namespace EmiROOT::Bench;
+
+namespace {
+
+  const double kPi = 3.14159265358979323846;
+
+  /// Location of the minimum of the Schwefel function along each axis
+  const double kSchwefelOpt = 420.9687462275036;
+
+  /// Generate a random orthogonal matrix by Gram-Schmidt orthonormalization
+  /// of a matrix with standard normal entries
+  std::vector<double> randomRotation(std::size_t d, Random& random) {
+    std::vector<double> m(d*d);
+    for (std::size_t k = 0; k < d*d; ++k) m[k] = random.norm();
+
+    for (std::size_t i = 0; i < d; ++i) {
+      double* row = &m[i*d];
+      for (std::size_t k = 0; k < i; ++k) {
+        const double* prev = &m[k*d];
+        double dot = 0.;
+        for (std::size_t j = 0; j < d; ++j) dot += row[j]*prev[j];
+        for (std::size_t j = 0; j < d; ++j) row[j] -= dot*prev[j];
+      }
+      double norm = 0.;
+      for (std::size_t j = 0; j < d; ++j) norm += row[j]*row[j];
+      norm = sqrt(norm);
+      for (std::size_t j = 0; j < d; ++j) row[j] /= norm;
+    }
+    return m;
+  }
+
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+TestFunction::TestFunction(Landscape t_landscape, std::size_t t_dim, bool t_shifted, bool t_rotated, uint64_t t_seed) :
+m_landscape(t_landscape),
+m_dim(t_dim),
+m_optimum(0.),
+m_shifted(t_shifted),
+m_rotated(t_rotated),
+m_shift(t_dim, 0.) {
+
+  switch (m_landscape) {
+    case SPHERE:     m_min = -5.12;   m_max = 5.12;   m_separable = true;  break;
+    case ROSENBROCK: m_min = -5.;     m_max = 10.;    m_separable = false; break;
+    case RASTRIGIN:  m_min = -5.12;   m_max = 5.12;   m_separable = true;  break;
+    case ACKLEY:     m_min = -32.768; m_max = 32.768; m_separable = false; break;
+    case GRIEWANK:   m_min = -600.;   m_max = 600.;   m_separable = false; break;
+    case SCHWEFEL:   m_min = -500.;   m_max = 500.;   m_separable = true;  break;
+    case LUNACEK:    m_min = -5.12;   m_max = 5.12;   m_separable = false; break;
+  }
+
+  m_name = getLandscapeName(m_landscape);
+  if (m_rotated) m_name = "rotated_" + m_name;
+  if (m_shifted) m_name = "shifted_" + m_name;
+  if (m_rotated) m_separable = false;
+
+  Random random(t_seed + 7919*(uint64_t)m_landscape + 104729*t_dim);
+  if (m_shifted) {
+    for (std::size_t j = 0; j < m_dim; ++j) m_shift[j] = random.rand(0.8*m_min, 0.8*m_max);
+  }
+  if (m_rotated) m_rotation = randomRotation(m_dim, random);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+double TestFunction::operator()(const Point& x) const {
+  // One scratch buffer per thread, so that the functions can be used by
+  // parallel evaluations and do not allocate after the first call
+  thread_local Point z, tmp;
+  z.resize(m_dim);
+  tmp.resize(m_dim);
+
+  if (!m_shifted && !m_rotated) return evaluateLandscape(x.data());
+
+  for (std::size_t j = 0; j < m_dim; ++j) tmp[j] = x[j] - m_shift[j];
+
+  if (m_rotated) {
+    for (std::size_t i = 0; i < m_dim; ++i) {
+      const double* row = &m_rotation[i*m_dim];
+      double s = 0.;
+      for (std::size_t j = 0; j < m_dim; ++j) s += row[j]*tmp[j];
+      z[i] = s;
+    }
+  } else {
+    z.swap(tmp);
+  }
+
+  // Landscapes whose optimum is not at the origin are moved so that
+  // the optimum of the transformed function lies at the shift vector
+  double offset = 0.;
+  if (m_landscape == ROSENBROCK) offset = 1.;
+  if (m_landscape == SCHWEFEL)   offset = kSchwefelOpt;
+  if (m_landscape == LUNACEK)    offset = 2.5;
+  if (offset != 0.) {
+    for (std::size_t j = 0; j < m_dim; ++j) z[j] += offset;
+  }
+
+  return evaluateLandscape(z.data());
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+double TestFunction::evaluateLandscape(const double* x) const {
+  double d = m_dim;
+  double s = 0.;
+
+  switch (m_landscape) {
+
+    case SPHERE: {
+      for (std::size_t j = 0; j < m_dim; ++j) s += x[j]*x[j];
+      return s;
+    }
+
+    case ROSENBROCK: {
+      for (std::size_t j = 0; j + 1 < m_dim; ++j) {
+        s += 100.*pow(x[j+1] - x[j]*x[j], 2) + pow(1. - x[j], 2);
+      }
+      return s;
+    }
+
+    case RASTRIGIN: {
+      for (std::size_t j = 0; j < m_dim; ++j) s += x[j]*x[j] - 10.*cos(2.*kPi*x[j]);
+      return 10.*d + s;
+    }
+
+    case ACKLEY: {
+      double c = 0.;
+      for (std::size_t j = 0; j < m_dim; ++j) {
+        s += x[j]*x[j];
+        c += cos(2.*kPi*x[j]);
+      }
+      return -20.*exp(-0.2*sqrt(s/d)) - exp(c/d) + 20. + exp(1.);
+    }
+
+    case GRIEWANK: {
+      double p = 1.;
+      for (std::size_t j = 0; j < m_dim; ++j) {
+        s += x[j]*x[j];
+        p *= cos(x[j]/sqrt(j + 1.));
+      }
+      return 1. + s/4000. - p;
+    }
+
+    case SCHWEFEL: {
+      // Bounded variant: outside [-500, 500] the sine term is folded back
+      // into the domain and a quadratic penalty is added, so that rotated
+      // and shifted instances keep the optimum inside the search space
+      for (std::size_t j = 0; j < m_dim; ++j) {
+        double z = x[j];
+        if (z > 500.) {
+          double r = 500. - fmod(z, 500.);
+          s += r*sin(sqrt(fabs(r))) - (z - 500.)*(z - 500.)/(10000.*d);
+        } else if (z < -500.) {
+          double r = fmod(fabs(z), 500.) - 500.;
+          s += r*sin(sqrt(fabs(r))) - (z + 500.)*(z + 500.)/(10000.*d);
+        } else {
+          s += z*sin(sqrt(fabs(z)));
+        }
+      }
+      return 418.9828872724339*d - s;
+    }
+
+    case LUNACEK: {
+      double mu0 = 2.5;
+      double dd  = 1.;
+      double sc  = 1. - 1./(2.*sqrt(d + 20.) - 8.2);
+      double mu1 = -sqrt((mu0*mu0 - dd)/sc);
+      double s0 = 0., s1 = 0., r = 0.;
+      for (std::size_t j = 0; j < m_dim; ++j) {
+        s0 += (x[j] - mu0)*(x[j] - mu0);
+        s1 += (x[j] - mu1)*(x[j] - mu1);
+        r  += 1. - cos(2.*kPi*(x[j] - mu0));
+      }
+      return std::min(s0, dd*d + sc*s1) + 10.*r;
+    }
+  }
+
+  return 0.;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::vector<Landscape> Bench::getLandscapes() {
+  return {SPHERE, ROSENBROCK, RASTRIGIN, ACKLEY, GRIEWANK, SCHWEFEL, LUNACEK};
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::string Bench::getLandscapeName(Landscape t) {
+  switch (t) {
+    case SPHERE:     return "sphere";
+    case ROSENBROCK: return "rosenbrock";
+    case RASTRIGIN:  return "rastrigin";
+    case ACKLEY:     return "ackley";
+    case GRIEWANK:   return "griewank";
+    case SCHWEFEL:   return "schwefel";
+    case LUNACEK:    return "lunacek";
+  }
+  return "";
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::vector<TestFunction> Bench::makeSuite(std::size_t d, uint64_t seed) {
+  std::vector<TestFunction> suite;
+  for (Landscape l : getLandscapes()) {
+    suite.push_back(TestFunction(l, d, false, false, seed));
+    suite.push_back(TestFunction(l, d, true,  false, seed));
+    suite.push_back(TestFunction(l, d, false, true,  seed));
+    suite.push_back(TestFunction(l, d, true,  true,  seed));
+  }
+  return suite;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
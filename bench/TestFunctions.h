@@ -0,0 +1,90 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+*/
+
+
+#ifndef EmiROOT_TestFunctions_h
+#define EmiROOT_TestFunctions_h
+
+#include <Base/Types.h>
+#include <string>
+#include <vector>
+
+namespace EmiROOT {
+
+  namespace Bench {
+
+    /// Base landscapes available in the benchmark suite
+    enum Landscape {SPHERE, ROSENBROCK, RASTRIGIN, ACKLEY, GRIEWANK, SCHWEFEL, LUNACEK};
+
+    /// A standard test function, optionally shifted and/or rotated.
+    /// A shifted function has its optimum moved to a random point of the
+    /// domain; a rotated function is evaluated on M*(x-o), with M a random
+    /// orthogonal matrix, which makes every landscape non-separable.
+    class TestFunction {
+    public:
+      TestFunction(Landscape, std::size_t, bool shifted, bool rotated, uint64_t seed);
+
+      /// Evaluate the function
+      double operator()(const Point&) const;
+
+      /// Return the name of the function, e.g. "shifted_rotated_rastrigin"
+      const std::string& getName() const {return m_name;}
+
+      std::size_t getDimension() const {return m_dim;}
+
+      /// Return the lower bound of the (hyper-cubic) domain
+      double getMin() const {return m_min;}
+
+      /// Return the upper bound of the (hyper-cubic) domain
+      double getMax() const {return m_max;}
+
+      /// Return the value of the global minimum
+      double getOptimum() const {return m_optimum;}
+
+      /// Return true if the function can be minimized one coordinate at a time
+      bool isSeparable() const {return m_separable;}
+
+    private:
+      double evaluateLandscape(const double*) const;
+
+      Landscape           m_landscape;
+      std::size_t         m_dim;
+      std::string         m_name;
+      double              m_min;
+      double              m_max;
+      double              m_optimum;
+      bool                m_separable;
+      bool                m_shifted;
+      bool                m_rotated;
+      Point               m_shift;    /**< Position of the optimum */
+      std::vector<double> m_rotation; /**< Row-major d x d orthogonal matrix */
+    };
+
+    /// Return the full list of landscapes
+    std::vector<Landscape> getLandscapes();
+
+    /// Return the name of a landscape
+    std::string getLandscapeName(Landscape);
+
+    /// Build the standard suite (plain, shifted, rotated and shifted+rotated
+    /// variant of every landscape) for the given dimension
+    std::vector<TestFunction> makeSuite(std::size_t, uint64_t seed);
+
+  }
+
+}
+#endif
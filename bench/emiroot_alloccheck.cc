@@ -0,0 +1,185 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+*/
+
+
+// Allocation check of the steady-state iterations.
+//
+// Every algorithm is run on a test function while the global operator new
+// counts the heap allocations. The count is sampled by an observer at the
+// end of each iteration: after the warm-up iterations no allocation is
+// expected. The program exits with status 1 if any algorithm allocates in
+// the steady state.
+//
+// Usage: emiroot_alloccheck [--dim 10] [--population 40] [--iterations 50]
+//                           [--warmup 5] [--algorithms ABC,PS,...]
+
+#include "Algorithms.h"
+#include "TestFunctions.h"
+#include <atomic>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <sstream>
+
+using namespace EmiROOT;
+using namespace EmiROOT::Bench;
+
+namespace {
+
+  std::atomic<std::size_t> s_allocations(0);
+
+}
+
+void* operator new(std::size_t t) {
+  s_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void* p = std::malloc(t ? t : 1)) return p;
+  throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t t) {
+  return operator new(t);
+}
+
+void operator delete(void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p) noexcept {
+  std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+  std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept {
+  std::free(p);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+namespace {
+
+  struct Options {
+    std::size_t              dim        = 10;
+    std::size_t              population = 40;
+    std::size_t              iterations = 50;
+    std::size_t              warmup     = 5;
+    std::vector<std::string> algorithms = getAlgorithmNames();
+  };
+
+  Options parseOptions(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i + 1 < argc; i += 2) {
+      std::string arg = argv[i];
+      std::string val = argv[i+1];
+      if (arg == "--dim") {
+        opt.dim = std::stoul(val);
+      } else if (arg == "--population") {
+        opt.population = std::stoul(val);
+      } else if (arg == "--iterations") {
+        opt.iterations = std::stoul(val);
+      } else if (arg == "--warmup") {
+        opt.warmup = std::stoul(val);
+      } else if (arg == "--algorithms") {
+        opt.algorithms.clear();
+        std::stringstream ss(val);
+        std::string item;
+        while (std::getline(ss, item, ',')) if (!item.empty()) opt.algorithms.push_back(item);
+      } else {
+        std::cerr << "Unknown option " << arg << "\n";
+        exit(1);
+      }
+    }
+    return opt;
+  }
+
+  /// Count the allocations done in the iterations after the warm-up
+  class AllocationObserver : public Observer {
+  public:
+    AllocationObserver(std::size_t t_warmup) : Observer(1), m_warmup(t_warmup) {}
+
+    void onIterationEnd(const PopulationView&, const IterationStats& t) override {
+      std::size_t now = s_allocations.load(std::memory_order_relaxed);
+      if (t.iteration > m_warmup) {
+        std::size_t n = now - m_last;
+        m_steady += n;
+        if (n > m_worst) m_worst = n;
+        m_iterations++;
+      }
+      m_last = now;
+    }
+
+    std::size_t getSteadyAllocations() const {return m_steady;}
+
+    std::size_t getWorstIteration() const {return m_worst;}
+
+    std::size_t getSteadyIterations() const {return m_iterations;}
+
+  private:
+    std::size_t m_warmup;
+    std::size_t m_last       = 0;
+    std::size_t m_steady     = 0; /**< Allocations in the iterations after the warm-up */
+    std::size_t m_worst      = 0; /**< Largest number of allocations in one iteration */
+    std::size_t m_iterations = 0;
+  };
+
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+int main(int argc, char** argv) {
+  Options opt = parseOptions(argc, argv);
+  std::size_t d = opt.dim;
+  TestFunction tf = makeSuite(d, 1)[0];
+  Function f = [&tf](const Point& x) { return tf(x); };
+
+  bool failed = false;
+  for (const std::string& name : opt.algorithms) {
+    // Budget matching the requested number of iterations
+    double per_iter = getEvaluationsPerIteration(name, opt.population, d);
+    RunSettings settings;
+    settings.population_size = opt.population;
+    settings.max_evaluations = opt.population + (std::size_t) ((opt.iterations - 1)*per_iter);
+    settings.range           = tf.getMax() - tf.getMin();
+
+    std::unique_ptr<Algorithm> algo = makeAlgorithm(name, f, settings, d);
+    Parameters parameters;
+    for (std::size_t j = 0; j < d; ++j) {
+      parameters.push_back(Parameter("x" + std::to_string(j), tf.getMin(), tf.getMax()));
+    }
+    algo->setParameters(parameters);
+    algo->setSilent(true);
+    algo->setSeed(1);
+
+    AllocationObserver observer(opt.warmup);
+    algo->addObserver(&observer);
+    algo->minimize();
+
+    bool ok = observer.getSteadyAllocations() == 0;
+    if (!ok) failed = true;
+    std::cout << std::left << std::setw(8) << name << std::right
+              << " steady-state iterations " << std::setw(4) << observer.getSteadyIterations()
+              << "  allocations " << std::setw(8) << observer.getSteadyAllocations()
+              << "  (max " << observer.getWorstIteration() << " per iteration)"
+              << (ok ? "" : "  FAILED") << "\n";
+  }
+
+  return failed ? 1 : 0;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
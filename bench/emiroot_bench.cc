@@ -0,0 +1,264 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+*/
+
+
+// Standard benchmark suite of EmiROOT.
+//
+// Every algorithm is run on every test function of the suite, for each
+// requested dimension and seed, with the same budget of objective function
+// evaluations. For each run the wall time, the time spent in the objective
+// function, the number of evaluations per second, the framework overhead per
+// evaluation and the number of evaluations needed to reach the target
+// precision are written to a JSON file. If EmiROOT is built with
+// EMIROOT_PROFILING the per-phase breakdown of the time is added to each run.
+//
+// Usage: emiroot_bench [--dims 2,10] [--algorithms ABC,PS,...]
+//                      [--functions sphere,shifted_rastrigin,...]
+//                      [--repeats 3] [--population 40] [--budget 2000]
+//                      [--target 1e-6] [--seed 1] [--design UNIFORM]
+//                      [--output emiroot_bench.json]
+//
+// The budget is given per dimension: a run on a d-dimensional function is
+// allowed budget*d evaluations. The design of the initial population is one
+// of UNIFORM, SOBOL, HALTON, LHS and MAXIMIN_LHS.
+
+#include "Algorithms.h"
+#include "JsonWriter.h"
+#include "TestFunctions.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <limits>
+#include <sstream>
+
+using namespace EmiROOT;
+using namespace EmiROOT::Bench;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+  struct Options {
+    std::vector<std::size_t> dims       = {2, 10};
+    std::vector<std::string> algorithms = getAlgorithmNames();
+    std::vector<std::string> functions;
+    std::size_t              repeats    = 3;
+    std::size_t              population = 40;
+    std::size_t              budget     = 2000;
+    double                   target     = 1.e-6;
+    uint64_t                 seed       = 1;
+    std::string              design     = "UNIFORM";
+    std::string              output     = "emiroot_bench.json";
+  };
+
+  /// Counters filled by the instrumented objective function
+  struct RunCounters {
+    std::size_t evaluations        = 0;
+    double      objective_time     = 0.; /**< Seconds spent in the objective function */
+    double      best               = std::numeric_limits<double>::max();
+    std::size_t evals_to_target    = 0;  /**< 0 if the target was never reached */
+  };
+
+  std::vector<std::string> split(const std::string& s) {
+    std::vector<std::string> v;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, ',')) if (!item.empty()) v.push_back(item);
+    return v;
+  }
+
+  Options parseOptions(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+      std::string arg = argv[i];
+      if (i + 1 >= argc) {
+        std::cerr << "Missing value for option " << arg << "\n";
+        exit(1);
+      }
+      std::string val = argv[++i];
+      if (arg == "--dims") {
+        opt.dims.clear();
+        for (auto& s : split(val)) opt.dims.push_back(std::stoul(s));
+      } else if (arg == "--algorithms") {
+        opt.algorithms = split(val);
+      } else if (arg == "--functions") {
+        opt.functions = split(val);
+      } else if (arg == "--repeats") {
+        opt.repeats = std::stoul(val);
+      } else if (arg == "--population") {
+        opt.population = std::stoul(val);
+      } else if (arg == "--budget") {
+        opt.budget = std::stoul(val);
+      } else if (arg == "--target") {
+        opt.target = std::stod(val);
+      } else if (arg == "--seed") {
+        opt.seed = std::stoull(val);
+      } else if (arg == "--design") {
+        opt.design = val;
+      } else if (arg == "--output") {
+        opt.output = val;
+      } else {
+        std::cerr << "Unknown option " << arg << "\n";
+        exit(1);
+      }
+    }
+    return opt;
+  }
+
+  bool isSelected(const std::vector<std::string>& list, const std::string& name) {
+    if (list.empty()) return true;
+    return std::find(list.begin(), list.end(), name) != list.end();
+  }
+
+  /// Average cost of a call to the clock, subtracted from the framework overhead
+  double clockOverhead() {
+    const std::size_t n = 100000;
+    auto t0 = Clock::now();
+    for (std::size_t i = 0; i < n; ++i) Clock::now();
+    return std::chrono::duration<double>(Clock::now() - t0).count()/n;
+  }
+
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+int main(int argc, char** argv) {
+  Options opt = parseOptions(argc, argv);
+  double clock_cost = clockOverhead();
+
+  std::ofstream out(opt.output);
+  if (!out) {
+    std::cerr << "Cannot open " << opt.output << "\n";
+    return 1;
+  }
+
+  JsonWriter json(out);
+  json.beginObject();
+  json.member("suite", "emiroot_bench");
+  json.member("population", opt.population);
+  json.member("budget_per_dimension", opt.budget);
+  json.member("target", opt.target);
+  json.member("repeats", opt.repeats);
+  json.member("design", opt.design);
+  json.member("clock_overhead_ns", clock_cost*1.e9);
+  json.key("runs");
+  json.beginArray();
+
+  for (std::size_t d : opt.dims) {
+    std::vector<TestFunction> suite = makeSuite(d, opt.seed);
+
+    for (const TestFunction& tf : suite) {
+      if (!isSelected(opt.functions, tf.getName())) continue;
+
+      for (const std::string& algo_name : opt.algorithms) {
+        for (std::size_t rep = 0; rep < opt.repeats; ++rep) {
+          RunCounters counters;
+          double optimum = tf.getOptimum();
+          double target  = opt.target;
+
+          // Instrumented objective function: the time spent outside of it
+          // is the cost of the framework
+          Function f = [&tf, &counters, optimum, target](const Point& x) {
+            auto t0 = Clock::now();
+            double value = tf(x);
+            counters.objective_time += std::chrono::duration<double>(Clock::now() - t0).count();
+            counters.evaluations++;
+            if (value < counters.best) counters.best = value;
+            if (counters.evals_to_target == 0 && value - optimum <= target) counters.evals_to_target = counters.evaluations;
+            return value;
+          };
+
+          RunSettings settings;
+          settings.population_size = opt.population;
+          settings.max_evaluations = opt.budget*d;
+          settings.range           = tf.getMax() - tf.getMin();
+
+          std::unique_ptr<Algorithm> algo = makeAlgorithm(algo_name, f, settings, d);
+          Parameters parameters;
+          for (std::size_t j = 0; j < d; ++j) {
+            parameters.push_back(Parameter("x" + std::to_string(j), tf.getMin(), tf.getMax()));
+          }
+          algo->setParameters(parameters);
+          algo->setSilent(true);
+          algo->setInitialDesign(opt.design);
+          algo->setSeed(opt.seed + 1000*rep + 1);
+
+          auto t0 = Clock::now();
+          algo->minimize();
+          double wall = std::chrono::duration<double>(Clock::now() - t0).count();
+          OptimizationResults results = algo->getResults();
+
+          double n_eval = counters.evaluations;
+          double framework = wall - counters.objective_time - n_eval*clock_cost;
+
+          json.beginObject();
+          json.member("algorithm", algo_name);
+          json.member("function", tf.getName());
+          json.member("dimension", d);
+          json.member("separable", tf.isSeparable());
+          json.member("repeat", rep);
+          json.member("iterations", results.iterations);
+          json.member("evaluations", counters.evaluations);
+          json.member("wall_time_s", wall);
+          json.member("objective_time_s", counters.objective_time);
+          json.member("evaluations_per_s", n_eval/wall);
+          json.member("overhead_per_evaluation_ns", n_eval > 0 ? 1.e9*framework/n_eval : 0.);
+          json.member("best_cost", results.best_cost);
+          json.member("error", counters.best - optimum);
+          json.key("evaluations_to_target");
+          if (counters.evals_to_target > 0) {
+            json.value(counters.evals_to_target);
+          } else {
+            json.null();
+          }
+          // Per-phase breakdown, available when EmiROOT is built with EMIROOT_PROFILING
+          const PerformanceReport& perf = results.performance;
+          if (perf.enabled) {
+            json.key("performance");
+            json.beginObject();
+            json.member("objective_time_s", perf.objective_time);
+            json.member("constraint_time_s", perf.constraint_time);
+            json.member("framework_time_s", perf.framework_time);
+            json.key("phases");
+            json.beginObject();
+            for (const PhaseTiming& phase : perf.phases) {
+              json.key(phase.name);
+              json.beginObject();
+              json.member("time_s", phase.time);
+              json.member("calls", phase.calls);
+              json.endObject();
+            }
+            json.endObject();
+            json.endObject();
+          }
+          json.endObject();
+
+          std::cout << algo_name << " " << tf.getName() << " d=" << d << " rep=" << rep
+                    << " error=" << counters.best - optimum << " evals=" << counters.evaluations
+                    << " time=" << wall << "s\n";
+        }
+      }
+    }
+  }
+
+  json.endArray();
+  json.endObject();
+  out << "\n";
+
+  return 0;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -0,0 +1,320 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+*/
+
+
+// Micro-benchmarks of the inner kernels of the framework.
+//
+// Each kernel is timed with the built-in harness of MicroBenchmark.h and the
+// median, mean, standard deviation and minimum time per call are reported on
+// the standard output and written to a JSON file.
+//
+// Usage: emiroot_microbench [--dim 10] [--population 40] [--samples 21]
+//                           [--filter substring] [--output emiroot_microbench.json]
+
+#include "JsonWriter.h"
+#include "MicroBenchmark.h"
+#include <Base/Kernels.h>
+#include <Base/Population.h>
+#include <DE/DEPopulation.h>
+#include <GA/GAPopulation.h>
+#include <GWO/GWOPopulation.h>
+#include <MFO/MFOPopulation.h>
+#include <PS/PSPopulation.h>
+#include <WOA/WOAPopulation.h>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+using namespace EmiROOT;
+using namespace EmiROOT::Bench;
+
+namespace {
+
+  struct Options {
+    std::size_t dim        = 10;
+    std::size_t population = 40;
+    std::size_t samples    = 21;
+    std::string filter     = "";
+    std::string output     = "emiroot_microbench.json";
+  };
+
+  Options parseOptions(int argc, char** argv) {
+    Options opt;
+    for (int i = 1; i + 1 < argc; i += 2) {
+      std::string arg = argv[i];
+      std::string val = argv[i+1];
+      if (arg == "--dim") {
+        opt.dim = std::stoul(val);
+      } else if (arg == "--population") {
+        opt.population = std::stoul(val);
+      } else if (arg == "--samples") {
+        opt.samples = std::stoul(val);
+      } else if (arg == "--filter") {
+        opt.filter = val;
+      } else if (arg == "--output") {
+        opt.output = val;
+      } else {
+        std::cerr << "Unknown option " << arg << "\n";
+        exit(1);
+      }
+    }
+    return opt;
+  }
+
+  /// Expose the protected kernels of Population
+  class ProbePopulation : public Population {
+  public:
+    ProbePopulation(Function f) : Population(f) {}
+    using Population::checkBoundary;
+    using Population::evaluateCost;
+  };
+
+  SearchSpace makeSearchSpace(std::size_t d, bool integer, uint64_t seed) {
+    SearchSpace space(d);
+    for (std::size_t j = 0; j < d; ++j) space.setParameter(j, "x" + std::to_string(j), -5., 5., integer);
+    space.setSeed(seed);
+    return space;
+  }
+
+  /// Configure the common part of a population used by the move kernels
+  template<typename P, typename C>
+  void setupPopulation(P& pop, C& config, std::size_t n, std::size_t d) {
+    config.setPopulationSize(n);
+    config.setNMaxIterations(1000);
+    pop.setConfig(config);
+    pop.setSearchSpace(makeSearchSpace(d, false, 17));
+    pop.setSeed(29);
+    pop.setOOB(RBC);
+    pop.setSilent(true);
+    pop.init();
+    pop.evaluate();
+  }
+
+  double sphere(const Point& x) {
+    double s = 0.;
+    for (double v : x) s += v*v;
+    return s;
+  }
+
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+int main(int argc, char** argv) {
+  Options opt = parseOptions(argc, argv);
+  std::size_t d = opt.dim;
+  std::size_t n = opt.population;
+  std::vector<Measurement> results;
+
+  auto run = [&](const std::string& name, auto&& kernel) {
+    if (!opt.filter.empty() && name.find(opt.filter) == std::string::npos) return;
+    Measurement m = measure(name, kernel, opt.samples);
+    std::cout << std::left << std::setw(44) << m.name << std::right
+              << " median " << std::setw(12) << std::fixed << std::setprecision(1) << m.median_ns << " ns"
+              << "  (min " << m.min_ns << ", sd " << m.stddev_ns << ")\n";
+    results.push_back(m);
+  };
+
+  //// Random number generator ////////////////////////////////
+  Random random(12345);
+  run("Random::rand", [&] { doNotOptimize(random.rand()); });
+  run("Random::norm", [&] { doNotOptimize(random.norm()); });
+  run("Random::randUInt", [&] { doNotOptimize(random.randUInt(0, 1000)); });
+  {
+    std::vector<double> u(d);
+    run("Random::fill[d]", [&] {
+      random.fill(u.data(), d);
+      doNotOptimize(u[0]);
+    });
+  }
+
+  //// Batch transcendental kernels ///////////////////////////
+  {
+    // Arguments in the range of the spiral parameters
+    std::vector<double> l = random.randVector(d, -2., 1.), y(d);
+    run("Kernels::exp[d]", [&] {
+      Kernels::exp(l.data(), y.data(), d);
+      doNotOptimize(y[0]);
+    });
+    run("std::exp[d]", [&] {
+      for (std::size_t j = 0; j < d; ++j) y[j] = std::exp(l[j]);
+      doNotOptimize(y[0]);
+    });
+    run("Kernels::cos2Pi[d]", [&] {
+      Kernels::cos2Pi(l.data(), y.data(), d);
+      doNotOptimize(y[0]);
+    });
+    run("std::cos[d]", [&] {
+      for (std::size_t j = 0; j < d; ++j) y[j] = std::cos(2*M_PI*l[j]);
+      doNotOptimize(y[0]);
+    });
+  }
+
+  //// Search space ///////////////////////////////////////////
+  {
+    SearchSpace space = makeSearchSpace(d, false, 3);
+    run("SearchSpace::getRandom", [&] { doNotOptimize(space.getRandom()[0]); });
+
+    // Sequence designs, started for more points than any calibration draws
+    const char* design_names[] = {"SOBOL", "HALTON"};
+    InitialDesignType designs[] = {SOBOL, HALTON};
+    for (int k = 0; k < 2; ++k) {
+      SearchSpace designed = makeSearchSpace(d, false, 3);
+      designed.setInitialDesign(designs[k]);
+      designed.startInitialDesign(std::size_t(1) << 31);
+      run(std::string("SearchSpace::getRandom[") + design_names[k] + "]", [&] { doNotOptimize(designed.getRandom()[0]); });
+    }
+
+    // About half of the points are rejected by the constraint
+    SearchSpace constrained = makeSearchSpace(d, false, 3);
+    constrained.setConstraints({Constraint([](const Point& x) { return x[0]; }, LEQ)});
+    constrained.setCostrInitPop(true);
+    run("SearchSpace::getRandom[constr_init_pop]", [&] { doNotOptimize(constrained.getRandom()[0]); });
+  }
+
+  //// Boundary check /////////////////////////////////////////
+  {
+    // Pool of points with about half of the coordinates out of the boundaries
+    Random gen(7);
+    std::vector<Point> pool(64, Point(d));
+    for (auto& p : pool) for (auto& x : p) x = gen.rand(-10., 10.);
+
+    const char* names[] = {"PBC", "RBC", "BAB", "DIS"};
+    OOBMethod methods[] = {PBC, RBC, BAB, DIS};
+    for (int m = 0; m < 4; ++m) {
+      ProbePopulation pop(sphere);
+      pop.setSearchSpace(makeSearchSpace(d, false, 5));
+      pop.setOOB(methods[m]);
+      Individual ind(d);
+      std::size_t k = 0;
+      run(std::string("Population::checkBoundary[") + names[m] + "]", [&] {
+        ind.getPosition() = pool[k++ & 63];
+        pop.checkBoundary(ind);
+        doNotOptimize(ind[0]);
+      });
+    }
+
+    // Cost of resetting the position alone, to be subtracted from the above
+    Individual ind(d);
+    std::size_t k = 0;
+    run("Population::checkBoundary[reset only]", [&] {
+      ind.getPosition() = pool[k++ & 63];
+      doNotOptimize(ind[0]);
+    });
+  }
+
+  //// Cost evaluation ////////////////////////////////////////
+  {
+    Function trivial = [](const Point&) { return 0.; };
+    Point x(d, 0.5);
+
+    ProbePopulation pop(trivial);
+    pop.setSearchSpace(makeSearchSpace(d, false, 5));
+    run("Population::evaluateCost[trivial]", [&] { doNotOptimize(pop.evaluateCost(x)); });
+
+    ProbePopulation pop_int(trivial);
+    pop_int.setSearchSpace(makeSearchSpace(d, true, 5));
+    Point xi(d, 0.5);
+    run("Population::evaluateCost[integer rounding]", [&] {
+      xi[0] = 0.4;
+      doNotOptimize(pop_int.evaluateCost(xi));
+    });
+
+    run("Function call[trivial]", [&] { doNotOptimize(trivial(x)); });
+  }
+
+  //// Move kernels ///////////////////////////////////////////
+  std::string size = "[N=" + std::to_string(n) + ",d=" + std::to_string(d) + "]";
+  {
+    GWOPopulation pop(sphere);
+    GWOConfig config;
+    setupPopulation(pop, config, n, d);
+    pop.updateAParameter(500);
+    run("GWOPopulation::moveWolves" + size, [&] { pop.moveWolves(); });
+  }
+  {
+    WOAPopulation pop(sphere);
+    WOAConfig config;
+    setupPopulation(pop, config, n, d);
+    pop.updateParameters(500);
+    run("WOAPopulation::moveWhales" + size, [&] { pop.moveWhales(); });
+  }
+  {
+    MFOPopulation pop(sphere);
+    MFOConfig config;
+    setupPopulation(pop, config, n, d);
+    pop.createFlames();
+    pop.updateParameters(500);
+    run("MFOPopulation::moveMoths" + size, [&] { pop.moveMoths(); });
+  }
+  {
+    PSPopulation pop(sphere);
+    PSConfig config;
+    config.setAlpha({0.5});
+    config.setAlphaEvolution(1.);
+    config.setCognitiveParameter(1.5);
+    config.setSocialParameter(1.5);
+    config.setInertia(0.9);
+    setupPopulation(pop, config, n, d);
+    pop.updateParameters(500);
+    run("PSPopulation::updateVelocity" + size, [&] { for (std::size_t i = 0; i < n; ++i) pop.updateVelocity(i); });
+  }
+  {
+    DEPopulation pop(sphere);
+    DEConfig config;
+    config.setStrategy(CURRENT_TO_PBEST_1);
+    config.setAdaptive(true);
+    setupPopulation(pop, config, n, d);
+    run("DEPopulation::generateTrials" + size, [&] { pop.generateTrials(); });
+  }
+  {
+    GAPopulation pop(sphere);
+    GAConfig config;
+    config.setKeepFraction(0.4);
+    config.setMutationRate(0.1);
+    setupPopulation(pop, config, n, d);
+    pop.sort();
+    run("GAPopulation::crossover" + size, [&] { pop.crossover(); });
+  }
+
+  //// Output /////////////////////////////////////////////////
+  std::ofstream out(opt.output);
+  JsonWriter json(out);
+  json.beginObject();
+  json.member("suite", "emiroot_microbench");
+  json.member("dimension", d);
+  json.member("population", n);
+  json.key("kernels");
+  json.beginArray();
+  for (const Measurement& m : results) {
+    json.beginObject();
+    json.member("name", m.name);
+    json.member("ops_per_sample", m.ops_per_sample);
+    json.member("samples", m.samples);
+    json.member("median_ns", m.median_ns);
+    json.member("mean_ns", m.mean_ns);
+    json.member("stddev_ns", m.stddev_ns);
+    json.member("min_ns", m.min_ns);
+    json.endObject();
+  }
+  json.endArray();
+  json.endObject();
+  out << "\n";
+
+  return 0;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -21,11 +21,12 @@
 
 #include "Bee.h"
 #include "ABCConfig.h"
-#include <Base/Population.h>
+#include <Base/PopulationBase.h>
+#include <Base/Selection.h>
 
 namespace EmiROOT {
 
-  class ABCPopulation : public Population {
+  class ABCPopulation : public PopulationBase<ABCPopulation, Bee, ABCConfig> {
   public:
 
     //// Common methods ///////////////////////////////////////
@@ -33,23 +34,6 @@ namespace EmiROOT {
 
     void init();
 
-    void setConfig(const ABCConfig&);
-
-    /// Access the specified bee
-    Bee &operator[](std::size_t t) { return m_individuals[t]; };
-
-    /// Return the position of all bees
-    std::vector<std::vector<double> > getPopulationPosition();
-
-    /// Return the size of the population
-    std::size_t getSize() {return m_individuals.size();};
-
-    /// Return the best bee
-    Bee* getBestSolution();
-
-    void evaluate();
-
-    void evaluate(Bee&);
     ///////////////////////////////////////////////////////////
 
     //// Specific methods /////////////////////////////////////
@@ -57,26 +41,27 @@ namespace EmiROOT {
 
     void onlookerBeesEvaluation();
 
-
   private:
-    void generateSolution(Bee&, std::size_t);
+    /// Move one coordinate of the copy of food source i towards or away
+    /// from another food source
+    void generateSolution(Bee&, std::size_t, Random&);
 
+    /// Build the table used by the onlookers to select the food sources
     void computeProbabilities();
 
     /// Return a random integer in [0, pop_size-1] different from the passed value
-    std::size_t getRandomPopulationIndex(std::size_t);
+    std::size_t getRandomPopulationIndex(std::size_t, Random&);
 
     // there is only one artificial employed bee for each food source
 
-    ABCConfig           m_config;
-    std::vector<Bee>    m_individuals; // the size of the entire colony
-    std::vector<double> m_prob;
+    std::vector<Bee>    m_candidates;  /**< Candidate solution of each employed bee, allocated once */
+    std::vector<Random> m_bee_random;  /**< Random stream of each employed bee */
+    std::vector<double> m_prob;        /**< Fitness of the food sources */
+    AliasTable          m_selector;    /**< Fitness-proportional selection of the food sources */
     std::vector<int>    m_trial;
     std::size_t              m_onlookers;
     std::size_t              m_scouters;
-    double              m_fitness_sum;
     std::size_t              m_limit_scout; // limit for scout
-    Bee                 m_best_solution;
   };
 
 }
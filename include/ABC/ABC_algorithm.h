@@ -19,25 +19,25 @@
 #ifndef EmiROOT_ABC_algorithm_h
 #define EmiROOT_ABC_algorithm_h
 
-#include <Base/Algorithm.h>
+#include <Base/AlgorithmBase.h>
 #include "ABCConfig.h"
 #include "ABCPopulation.h"
 
 namespace EmiROOT {
 
-  class ABC_algorithm : public Algorithm {
+  class ABC_algorithm : public AlgorithmBase<ABC_algorithm, ABCPopulation, ABCConfig> {
   public:
     ABC_algorithm(const Function&, const ABCConfig&);
 
-    void setSeed(uint64_t);
-
-    void minimize();
-
   private:
+    friend class AlgorithmBase<ABC_algorithm, ABCPopulation, ABCConfig>;
 
-    ABCConfig m_algo_config;
-    ABCPopulation m_population;
+    /// Advance the population by one iteration
+    void step();
   };
 
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<ABC_algorithm, ABCPopulation, ABCConfig>;
+
 }
 #endif
@@ -40,6 +40,11 @@ namespace EmiROOT {
 
     void setMaxFrequency(double);
 
+    /// Set the number of bats moved and evaluated together (concurrently
+    /// with setNThreads) before the best solution is updated; 1 is the
+    /// sequential algorithm (4 by default)
+    void setBatchSize(std::size_t);
+
     double getMaxVelocity(std::size_t) const;
 
     double getInitialLoudness() const;
@@ -54,6 +59,8 @@ namespace EmiROOT {
 
     double getMaxFrequency() const;
 
+    std::size_t getBatchSize() const;
+
   private:
     double              m_initial_loudness;   /**< Initial loudness */
     double              m_alpha;              /**< Parameter in [0, 1] to control how quickly the loudness changes */
@@ -61,6 +68,7 @@ namespace EmiROOT {
     double              m_gamma;
     double              m_fmin;  /**< Minimum frequency */
     double              m_fmax;  /**< Maximum frequency */
+    std::size_t         m_batch_size; /**< Bats evaluated before the best solution is updated */
   };
 
 }
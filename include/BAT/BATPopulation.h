@@ -21,11 +21,11 @@
 
 #include "Bat.h"
 #include "BATConfig.h"
-#include <Base/Population.h>
+#include <Base/PopulationBase.h>
 
 namespace EmiROOT {
 
-  class BATPopulation : public Population {
+  class BATPopulation : public PopulationBase<BATPopulation, Bat, BATConfig> {
   public:
 
     //// Common methods ///////////////////////////////////////
@@ -33,23 +33,6 @@ namespace EmiROOT {
 
     void init();
 
-    void setConfig(const BATConfig&);
-
-    /// Access the specified bat
-    Bat &operator[](std::size_t t) { return m_individuals[t]; };
-
-    /// Return the position of all bats
-    std::vector<std::vector<double> > getPopulationPosition();
-
-    /// Return the size of the population
-    std::size_t getSize() {return m_individuals.size();};
-
-    /// Return the best bat
-    Bat* getBestSolution();
-
-    void evaluate();
-
-    void evaluate(Bat&);
     ///////////////////////////////////////////////////////////
 
     //// Specific methods /////////////////////////////////////
@@ -59,14 +42,15 @@ namespace EmiROOT {
 
     void updateLoudnessAndPulse(std::size_t);
 
+    /// Generate and evaluate a candidate for each bat, then replace the
+    /// bats whose candidate is accepted
     void moveBats();
 
-
   private:
 
-    BATConfig           m_config;   /**< Configuration */
-    Bat                 m_best_solution;
-    std::vector<Bat>    m_individuals;    /**< Bats in the population */
+    std::vector<Bat>    m_candidates;  /**< Candidate solution of each bat, allocated once */
+    std::vector<Random> m_bat_random;  /**< Random stream of each bat */
+    std::vector<char>   m_accept;      /**< True if the candidate of the bat can replace it (loudness) */
     double              m_loudness;
     double              m_pulse_rate;
   };
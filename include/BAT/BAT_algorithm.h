@@ -19,25 +19,25 @@
 #ifndef EmiROOT_BAT_algorithm_h
 #define EmiROOT_BAT_algorithm_h
 
-#include <Base/Algorithm.h>
+#include <Base/AlgorithmBase.h>
 #include "BATConfig.h"
 #include "BATPopulation.h"
 
 namespace EmiROOT {
 
-  class BAT_algorithm : public Algorithm {
+  class BAT_algorithm : public AlgorithmBase<BAT_algorithm, BATPopulation, BATConfig> {
   public:
     BAT_algorithm(const Function&, const BATConfig&);
 
-    void setSeed(uint64_t);
-
-    void minimize();
-
   private:
+    friend class AlgorithmBase<BAT_algorithm, BATPopulation, BATConfig>;
 
-    BATConfig m_algo_config;
-    BATPopulation m_population;
+    /// Advance the population by one iteration
+    void step();
   };
 
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<BAT_algorithm, BATPopulation, BATConfig>;
+
 }
 #endif
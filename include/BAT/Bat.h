@@ -40,6 +40,9 @@ namespace EmiROOT {
     /// Return a velocity component
     double getVelocity(std::size_t t);
 
+    /// Return the velocity, to be updated in place
+    std::vector<double>& getVelocity() {return m_velocity;};
+
     /// Return frequency range
     double getFrequency() const;
 
@@ -24,7 +24,8 @@
 #include "Types.h"
 #include "Population.h"
 #include "Results.h"
-#include "ProgressBar.h"
+#include "Observer.h"
+#include "Profiler.h"
 #include <string>
 #include <fstream>
 
@@ -47,6 +48,29 @@ namespace EmiROOT {
     void setStartPenaltyCoeff(double);
     void setMaxPenaltyCoeff(double);
     void setCostrInitPop(bool);
+
+    /// Set the maximum number of points drawn to find one satisfying the
+    /// constraints when setCostrInitPop is used (10000 by default); then
+    /// the point with the smallest violation is taken
+    void setCostrInitPopMaxTrials(std::size_t);
+
+    /// Set the design of the initial population: UNIFORM (the default),
+    /// SOBOL, HALTON, LHS or MAXIMIN_LHS
+    void setInitialDesign(std::string);
+
+    /// Set the incremental form of the objective function, used in place
+    /// of it when a candidate differs from its parent in at most the given
+    /// number of coordinates. Only unconstrained minimizations use it.
+    void setDeltaFunction(const DeltaFunction&, std::size_t = 1);
+
+    /// Set the number of threads used by the algorithms that evaluate
+    /// several candidates at once. With more than one thread the objective
+    /// function (and the constraints) must be safe to call concurrently.
+    void setNThreads(std::size_t);
+
+    /// Add an observer of the minimization. The observer is not owned
+    /// by the algorithm and must outlive the calls to minimize().
+    void addObserver(Observer*);
     OptimizationResults   getResults();
     virtual void setSeed(uint64_t) = 0;
     virtual void minimize() = 0;
@@ -54,9 +78,27 @@ namespace EmiROOT {
   protected:
     double rand();
     void addPopulationPosition(std::vector<std::vector<double> >);
-    ProgressBar       m_progress_bar;
+
+    /// Prepare the observers for a new minimization
+    void startObservers();
+
+    /// Invoke the observers at the end of an iteration (iteration 0 being the initialization)
+    void notifyIteration(Population&, std::size_t);
+
+    /// Invoke the observers at the end of the minimization
+    void notifyTermination(Population&, std::size_t);
+
+    /// Compute the statistics of the population passed to the observers
+    IterationStats getIterationStats(Population&, std::size_t);
+
+    ProgressBarObserver    m_progress_observer;
+    std::vector<Observer*> m_observers;
+    double                 m_observed_best_cost; /**< Best cost at the last notification */
 
     Function          m_obj_function;
+    DeltaFunction     m_delta_function;
+    std::size_t       m_delta_max_changed;
+    std::size_t       m_n_threads;
     Constraints       m_constraints;
     SearchSpace       m_search_space;
     ParametersName    m_parameter_names;
@@ -76,7 +118,10 @@ namespace EmiROOT {
     double            m_penalty_scaling;
     double            m_start_penalty_param;
     double            m_max_penalty_param;
+    InitialDesignType m_initial_design;
+    std::size_t       m_max_trials;
     PopulationHistory m_population_history;
+    Profiler          m_profiler;
   };
 
 }
@@ -0,0 +1,171 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_AlgorithmBase_h
+#define EmiROOT_AlgorithmBase_h
+
+#include "Algorithm.h"
+
+namespace EmiROOT {
+
+  /// Base of the algorithms (CRTP). It implements the minimization loop
+  /// shared by all the algorithms: configuration of the population,
+  /// profiling, observers, cost history, evaluation budget and the check
+  /// on the iterations at the same cost. The algorithm only provides
+  /// Derived::step, which advances the population by one iteration, and
+  /// may hide Derived::initialize to extend the evaluation of the initial
+  /// population. Both calls are resolved at compile time.
+  template<typename Derived, typename PopulationT, typename ConfigT>
+  class AlgorithmBase : public Algorithm {
+  public:
+    AlgorithmBase(const Function& t_function, const ConfigT& t_config) :
+    Algorithm(t_function),
+    m_algo_config(t_config),
+    m_population(t_function) {}
+
+    void setSeed(uint64_t t_seed) {
+      m_search_space.setSeed(t_seed);
+      m_population.setSeed(t_seed);
+    }
+
+    void minimize();
+
+  protected:
+    /// Evaluate the initial population
+    void initialize() {m_population.evaluate();}
+
+    ConfigT     m_algo_config;
+    PopulationT m_population;
+  };
+  //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+  template<typename Derived, typename PopulationT, typename ConfigT>
+  void AlgorithmBase<Derived, PopulationT, ConfigT>::minimize() {
+    Derived* algo = static_cast<Derived*>(this);
+
+    m_iter = 0;
+    std::size_t n_iter = m_algo_config.getNMaxIterations();
+    m_profiler.start(n_iter);
+    double tolerance = m_algo_config.getAbsoluteTol();
+
+    // Initialization of the population
+    m_population.setConfig(m_algo_config);
+    m_population.setSearchSpace(m_search_space);
+    m_population.setConstraints(m_constraints);
+    m_population.setConstrainedMethod(m_constrained_method);
+    m_population.setPenaltyScaling(m_penalty_scaling);
+    m_population.setStartPenaltyCoeff(m_start_penalty_param);
+    m_population.setMaxPenaltyCoeff(m_max_penalty_param);
+    m_population.setOOB(m_oob_sol);
+    m_population.setMaximization(m_maximize);
+    m_population.setInitialPopulation(m_initial_population);
+    m_population.setSilent(m_silent);
+    m_population.setDeltaFunction(m_delta_function, m_delta_max_changed);
+    m_population.setNThreads(m_n_threads);
+    m_population.setMaxEvaluations(m_algo_config.getMaxEvaluations());
+    m_population.setProfiler(&m_profiler);
+    EMIROOT_PROFILE_BEGIN(init_timer, &m_profiler, INITIALIZATION);
+    m_population.init();
+    const SearchSpace& space = m_population.getSearchSpace();
+    if (!m_silent && space.getNRejected() > 0) {
+      std::cout << space.getNRejected() << " random points rejected by the constraints, "
+                << space.getNInfeasible() << " infeasible points kept\n";
+    }
+
+    // Initialize the observers
+    startObservers();
+
+    // Evaluate the cost for the population
+    algo->initialize();
+
+    EMIROOT_PROFILE_END(init_timer);
+    EMIROOT_PROFILE_ITERATION(&m_profiler, m_population.getNEvaluations());
+
+    // Update the cost history
+    double current_best_cost = m_maximize ? -m_population.getBestSolution()->getCost() : m_population.getBestSolution()->getCost();
+    m_cost_history.resize(n_iter);
+    m_cost_history[0] = current_best_cost;
+
+    // Update the population position history
+    if (m_save_population) addPopulationPosition(m_population.getPopulationPosition());
+
+    // Notify the observers of the initial population
+    notifyIteration(m_population, n_iter);
+
+    // Check if it is necessary to control the number of iterations at the same cost
+    bool do_check_same_cost = false;
+    if (n_iter > m_algo_config.getNMaxIterationsSameCost()) do_check_same_cost = true;
+
+    std::size_t n_sc = 0;
+    for (m_iter = 1; m_iter < n_iter; ++m_iter) {
+
+      // Scale the penalty coefficient for
+      // constrained optimization
+      m_population.scalePenaltyCoeff();
+
+      EMIROOT_PROFILE_BEGIN(move_timer, &m_profiler, MOVE);
+
+      // Move the population
+      algo->step();
+
+      EMIROOT_PROFILE_END(move_timer);
+
+      EMIROOT_PROFILE_BEGIN(history_timer, &m_profiler, HISTORY);
+
+      // Update the cost history
+      current_best_cost = m_maximize ? -m_population.getBestSolution()->getCost() : m_population.getBestSolution()->getCost();
+      m_cost_history[m_iter] = current_best_cost;
+
+      // Update the population position history
+      if (m_save_population) addPopulationPosition(m_population.getPopulationPosition());
+      EMIROOT_PROFILE_END(history_timer);
+      EMIROOT_PROFILE_ITERATION(&m_profiler, m_population.getNEvaluations());
+
+      // Notify the observers
+      notifyIteration(m_population, n_iter);
+
+      // Stop when the budget of cost evaluations is exhausted
+      if (m_population.isBudgetExhausted()) {
+        m_cost_history.resize(m_iter+1);
+        break;
+      }
+
+      // Check on same cost iterations
+      if (do_check_same_cost) {
+        if (m_iter > 0 && tolerance == 0 && Utility::areEqual(m_cost_history[m_iter-1], m_cost_history[m_iter], 2) ) { //check machine defined precision
+          n_sc++;
+        } else if (m_iter > 0 && tolerance != 0 && (m_cost_history[m_iter-1] - m_cost_history[m_iter]) < tolerance) { //check using user defined precision
+          n_sc++;
+        }  else {
+          n_sc = 0;
+        };
+        if (n_sc > m_algo_config.getNMaxIterationsSameCost()) {
+          m_cost_history.resize(m_iter+1);
+          break;
+        }
+      }
+    }
+
+    m_profiler.stop();
+    notifyTermination(m_population, n_iter);
+    m_population_base = &m_population;
+  }
+  //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+}
+#endif
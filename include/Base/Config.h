@@ -40,6 +40,9 @@ namespace EmiROOT {
     /// Set the number of individuals in the population
     void setPopulationSize(std::size_t);
 
+    /// Set the maximum number of cost function evaluations (0 for no limit)
+    void setMaxEvaluations(std::size_t);
+
     /// Return the maximum number of iterations
     std::size_t getNMaxIterations() const;
 
@@ -52,11 +55,15 @@ namespace EmiROOT {
     /// Return the number of individuals in the population
     std::size_t getPopulationSize() const;
 
+    /// Return the maximum number of cost function evaluations (0 for no limit)
+    std::size_t getMaxEvaluations() const;
+
   protected:
     int    m_nmax_iter;       /**< Maximum number of iterations */
     double m_absolute_tol;    /**< Maximum difference in between consecutive iterations to be considered to have the same cost */
     int    m_nmax_iter_scost; /**< Maximum number of consecutive iterations with approximately the same cost */
     int    m_nparticles;      /**< Number of individuals in the population */
+    std::size_t m_nmax_eval;  /**< Maximum number of cost function evaluations */
   };
 
 }
@@ -23,6 +23,11 @@
 
 namespace EmiROOT {
 
+  /// Point of the search space with its cost. The individual knows if its
+  /// cost is up to date: setting the cost marks it as evaluated, while any
+  /// non-const access to the position marks it as changed. Code that only
+  /// reads the position of an individual should do it through a const
+  /// reference, so that the cost is not recomputed needlessly.
   class Individual {
   public:
     /// Empty constructor
@@ -30,26 +35,44 @@ namespace EmiROOT {
 
     virtual ~Individual() {};
 
+    Individual(const Individual&) = default;
+    Individual(Individual&&) = default;
+    Individual& operator=(const Individual&) = default;
+    Individual& operator=(Individual&&) = default;
+
     /// Individual default constructor
     Individual(int n);
 
-    /// Set the cost
-    void setCost(double);
+    /// Set the cost and the total violation of the constraints included
+    /// in it by the penalty method, and mark the individual as evaluated
+    void setCost(double, double = 0.);
 
     /// Set the positions
     void setPosition(const Point&);
 
+    /// Return true if the cost is the one of the current position
+    bool isEvaluated() const {return m_evaluated;};
+
+    /// Mark the position as changed, so that the cost is evaluated again
+    void setChanged() {m_evaluated = false;};
+
     /// Return the the number of dimensions of the search space
     std::size_t getDimension() const;
 
+    /// Return the position, which is then considered changed
+    Point& getPosition() { m_evaluated = false; return m_position; };
+
     /// Return the position
-    Point& getPosition() { return m_position; };
+    const Point& getPosition() const { return m_position; };
 
-    /// Return the parameters
-    Point& getParameters() { return m_position; };
+    /// Return the parameters, which are then considered changed
+    Point& getParameters() { m_evaluated = false; return m_position; };
 
     /// Return the cost
-    double getCost();
+    double getCost() const;
+
+    /// Return the total violation of the constraints included in the cost
+    double getViolation() const {return m_violation;};
 
     virtual double getVelocity(std::size_t) {
       return 0.;
@@ -59,8 +82,8 @@ namespace EmiROOT {
 
     virtual void setVelocity(std::size_t, double) {};
 
-    /// Access the specified component
-    double &operator[](std::size_t t) { return m_position[t]; };
+    /// Access the specified component, which is then considered changed
+    double &operator[](std::size_t t) { m_evaluated = false; return m_position[t]; };
 
     /// Access the specified component
     double operator[](std::size_t t) const { return m_position[t]; };
@@ -71,7 +94,9 @@ namespace EmiROOT {
 
     Point  m_position;
     double m_cost;
+    double m_violation; /**< Violation of the constraints included in the cost by the penalty method */
     bool   m_has_velocity;
+    bool   m_evaluated; /**< True if m_cost is the cost of m_position */
   };
 
 }
@@ -0,0 +1,90 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_InitialDesign_h
+#define EmiROOT_InitialDesign_h
+
+#include "Random.h"
+#include <stdint.h>
+#include <vector>
+
+namespace EmiROOT {
+
+  /// - UNIFORM    : independent uniform points
+  /// - SOBOL      : Sobol sequence, scrambled by a random linear matrix and a digital shift
+  /// - HALTON     : Halton sequence, with a random linear scrambling of the digits
+  /// - LHS        : Latin hypercube, one point in each of the n slices of each parameter
+  /// - MAXIMIN_LHS: Latin hypercube improved by exchanges to spread out its closest points
+  enum InitialDesignType {UNIFORM, SOBOL, HALTON, LHS, MAXIMIN_LHS};
+
+  /// Generator of the points of the initial population in the unit cube.
+  /// The Sobol and Halton sequences cover the cube more evenly than the
+  /// independent points, so that fewer individuals are wasted in the same
+  /// region; they can be continued beyond the requested number of points,
+  /// e.g. to replace the ones rejected by the constraints. The Latin
+  /// hypercubes have exactly the requested number of points, after which
+  /// the generator is exhausted.
+  class InitialDesign {
+  public:
+    InitialDesign();
+
+    /// Set the type of design
+    void setType(InitialDesignType t) {m_type = t;}
+
+    /// Return the type of design
+    InitialDesignType getType() const {return m_type;}
+
+    /// Prepare a design of n points in d dimensions, drawing the
+    /// scrambling from the given generator. A UNIFORM design draws
+    /// nothing and is always exhausted.
+    void start(std::size_t, std::size_t, Random&);
+
+    /// Write the next point of the design in the array and return true,
+    /// or return false if the design is exhausted
+    bool next(double*);
+
+    /// Drop the design: the generator is exhausted until the next start
+    void stop();
+
+  private:
+    void startSobol(Random&);
+
+    void startHalton(Random&);
+
+    void startLatinHypercube(Random&);
+
+    /// Exchange the coordinates of pairs of points of the Latin hypercube
+    /// when the exchange lowers the Morris-Mitchell criterion
+    void spreadLatinHypercube(Random&);
+
+    InitialDesignType        m_type;       /**< Type of design */
+    bool                     m_active;     /**< Whether the design is started and not exhausted */
+    std::size_t              m_n;          /**< Number of points requested */
+    std::size_t              m_d;          /**< Number of dimensions */
+    std::size_t              m_index;      /**< Index of the next point */
+    std::vector<uint32_t>    m_directions; /**< Scrambled direction numbers of Sobol, 32 for each dimension */
+    std::vector<uint32_t>    m_state;      /**< Current point of Sobol */
+    std::vector<unsigned>    m_bases;      /**< Prime base of each dimension of Halton */
+    std::vector<unsigned>    m_digits;     /**< Scrambling (factor, shift) of each digit of each dimension of Halton */
+    std::vector<std::size_t> m_offsets;    /**< Position of the first digit of each dimension of Halton */
+    std::vector<double>      m_tails;      /**< Contribution of the zero digits from each position on */
+    std::vector<double>      m_points;     /**< Points of the Latin hypercube, n x d */
+  };
+
+}
+#endif
@@ -0,0 +1,76 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_Kernels_h
+#define EmiROOT_Kernels_h
+
+#include <cstddef>
+
+namespace EmiROOT {
+
+  /// Batch kernels of the moves of the algorithms following one or more
+  /// leaders (WOA, MFO, GWO, PS) and of the differential evolution. They
+  /// work on the contiguous coordinates of an individual with branch-free
+  /// loops, which the compiler vectorizes with the widest instruction set
+  /// enabled: SSE2 by default, AVX2 or AVX-512 when EmiROOT is built with
+  /// EMIROOT_NATIVE. The random numbers are drawn beforehand with
+  /// Random::fill.
+  namespace Kernels {
+
+    /// y[i] = exp(x[i]), with a relative error below 1e-15 for x[i] in
+    /// [-708, 709]; the arguments outside are clamped
+    void exp(const double* x, double* y, std::size_t n);
+
+    /// y[i] = cos(2 pi t[i]), with an absolute error below 1e-15
+    void cos2Pi(const double* t, double* y, std::size_t n);
+
+    /// Logarithmic spiral around a target with a common factor:
+    /// x[i] = |target[i] - x[i]| factor + target[i]
+    void spiral(double* x, const double* target, double factor, std::size_t n);
+
+    /// Logarithmic spiral around a target with one parameter per coordinate:
+    /// x[i] = |target[i] - x[i]| exp(b l[i]) cos(2 pi l[i]) + target[i]
+    void spiral(double* x, const double* target, const double* l, double b, std::size_t n);
+
+    /// Encircling of a target: x[i] = target[i] - A |C target[i] - x[i]|
+    void encircle(double* x, const double* target, double A, double C, std::size_t n);
+
+    /// Average of the encircling moves around three leaders, each with its
+    /// own A = 2 a r1 - a and C = 2 r2 per coordinate. The random numbers r
+    /// are six blocks of n: r1 and r2 for alpha, then for beta and delta.
+    void encircle(double* x, const double* alpha, const double* beta, const double* delta,
+                  const double* r, double a, std::size_t n);
+
+    /// Velocity of a particle, attracted by its best position and by the
+    /// one of its guide, and limited to [-max_v[i], max_v[i]]:
+    /// v[i] = w v[i] + c1 r1[i] (best[i] - x[i]) + c2 r2[i] (guide[i] - x[i]).
+    /// The random numbers r are two blocks of n, r1 then r2.
+    void velocity(double* v, const double* x, const double* best, const double* guide, const double* r,
+                  double w, double c1, double c2, const double* max_v, std::size_t n);
+
+    /// Differential mutation with binomial crossover:
+    /// u[i] = base[i] + f (p[i] - q[i]) + g (s[i] - t[i]) if r[i] < cr, x[i]
+    /// otherwise. The coordinate always taken from the mutant is forced by
+    /// a negative r[i].
+    void differential(double* u, const double* x, const double* base, const double* p, const double* q,
+                      const double* s, const double* t, const double* r, double f, double g, double cr, std::size_t n);
+
+  }
+
+}
+#endif
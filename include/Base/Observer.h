@@ -0,0 +1,102 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_Observer_h
+#define EmiROOT_Observer_h
+
+#include "Population.h"
+#include "ProgressBar.h"
+
+namespace EmiROOT {
+
+  /// Statistics of the minimization at the end of an iteration. The costs
+  /// have the sign of the objective function also in case of maximization.
+  struct IterationStats {
+    std::size_t iteration;
+    std::size_t max_iterations;
+    double      best_cost;    /**< Best cost found so far */
+    double      mean_cost;    /**< Mean cost of the current population */
+    double      worst_cost;   /**< Worst cost of the current population */
+    std::size_t evaluations;  /**< Number of cost evaluations so far */
+    double      elapsed_time; /**< Time since the start of the minimization [s] */
+  };
+
+
+  /// Read-only access to the individuals of a population
+  class PopulationView {
+  public:
+    PopulationView(Population& t) : m_population(t) {}
+
+    /// Return the number of individuals
+    std::size_t size() const {return m_population.getSize();}
+
+    /// Access the specified individual
+    const Individual& operator[](std::size_t t) const {return *m_population.getIndividual(t);}
+
+    /// Return the best solution found so far
+    const Individual& getBestSolution() const {return *m_population.getBestSolution();}
+
+  private:
+    Population& m_population;
+  };
+
+
+  /// Base class of the objects following the progress of a minimization.
+  /// onIterationEnd is invoked every getInterval() iterations (never if
+  /// the interval is 0), onNewBest whenever the best cost improves and
+  /// onTermination once at the end of the minimization.
+  class Observer {
+  public:
+    Observer(std::size_t t_interval = 1) : m_interval(t_interval) {}
+
+    virtual ~Observer() {}
+
+    virtual void onIterationEnd(const PopulationView&, const IterationStats&) {}
+
+    virtual void onNewBest(const PopulationView&, const IterationStats&) {}
+
+    virtual void onTermination(const PopulationView&, const IterationStats&) {}
+
+    /// Set the number of iterations in between calls to onIterationEnd
+    void setInterval(std::size_t t) {m_interval = t;}
+
+    std::size_t getInterval() const {return m_interval;}
+
+    /// Return true if onIterationEnd must be invoked at the given iteration
+    bool isDue(std::size_t t) const {return m_interval > 0 && t % m_interval == 0;}
+
+  private:
+    std::size_t m_interval; /**< Number of iterations in between calls to onIterationEnd */
+  };
+
+
+  /// Progress bar on the standard output, updated every 10 iterations
+  class ProgressBarObserver : public Observer {
+  public:
+    ProgressBarObserver();
+
+    void onIterationEnd(const PopulationView&, const IterationStats&) override;
+
+    void onTermination(const PopulationView&, const IterationStats&) override;
+
+  private:
+    ProgressBar m_progress_bar;
+  };
+
+}
+#endif
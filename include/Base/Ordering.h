@@ -0,0 +1,118 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_Ordering_h
+#define EmiROOT_Ordering_h
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace EmiROOT {
+
+  /// Ranking of a set of individuals by increasing cost. Only compact
+  /// (cost, index) keys are ordered, so that the individuals, which hold
+  /// several vectors each, stay where they are. Algorithms needing only
+  /// the best k individuals can select or partially sort the keys instead
+  /// of sorting the whole population. When the cost of one individual of
+  /// a sorted ranking changes, update moves its key with a binary search,
+  /// so keeping the order costs O(log N) comparisons instead of a sort.
+  class Ordering {
+  public:
+    Ordering() {}
+
+    /// Load the keys of the individuals, in the order of the vector
+    template<typename T>
+    void set(const std::vector<T>& t) {
+      m_keys.resize(t.size());
+      for (std::size_t i = 0; i < t.size(); ++i) m_keys[i] = {t[i].getCost(), i};
+    }
+
+    /// Sort all the keys by cost
+    void sort();
+
+    /// Sort the best k keys among the first n ranks (all by default) and
+    /// place them in front; the order of the others is unspecified
+    void partialSort(std::size_t, std::size_t = npos);
+
+    /// Place the best k keys among the first n ranks (all by default) in
+    /// front, in an unspecified order, and the others after them
+    void select(std::size_t, std::size_t = npos);
+
+    /// Return the index of the individual with the given rank
+    std::size_t operator[](std::size_t r) const {return m_keys[r].index;}
+
+    /// Return the cost of the individual with the given rank
+    double getCost(std::size_t r) const {return m_keys[r].cost;}
+
+    /// Return the index of the individual with the highest rank
+    std::size_t getWorst() const {return m_keys.back().index;}
+
+    /// Return the cost of the individual with the highest rank
+    double getWorstCost() const {return m_keys.back().cost;}
+
+    std::size_t getSize() const {return m_keys.size();}
+
+    /// Set the cost of the individual with the given rank of a sorted
+    /// ranking and move it to its new rank, after the ones with the same
+    /// cost. Return the new rank.
+    std::size_t update(std::size_t, double);
+
+    /// Move the individuals so that the one with rank r is at position r.
+    /// Each individual is moved at most once, following the cycles of the
+    /// permutation; the keys then refer to the new positions.
+    template<typename T>
+    void permute(std::vector<T>& t) {
+      m_done.assign(m_keys.size(), false);
+      for (std::size_t r = 0; r < m_keys.size(); ++r) {
+        if (m_done[r] || m_keys[r].index == r) {
+          m_keys[r].index = r;
+          continue;
+        }
+        T tmp = std::move(t[r]);
+        std::size_t cur = r;
+        while (true) {
+          std::size_t next = m_keys[cur].index;
+          m_done[cur] = true;
+          m_keys[cur].index = cur;
+          if (next == r) {
+            t[cur] = std::move(tmp);
+            break;
+          }
+          t[cur] = std::move(t[next]);
+          cur = next;
+        }
+      }
+    }
+
+    static const std::size_t npos = -1;
+
+  private:
+    struct Key {
+      double      cost;
+      std::size_t index;
+
+      friend bool operator<(const Key& l, const Key& r) {return l.cost < r.cost;}
+    };
+
+    std::vector<Key>  m_keys; /**< Keys, ordered by the last call */
+    std::vector<bool> m_done; /**< Positions already filled by permute */
+  };
+
+}
+#endif
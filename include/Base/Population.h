@@ -23,6 +23,10 @@
 #include "Types.h"
 #include "Random.h"
 #include "Individual.h"
+#include "Profiler.h"
+#include "ThreadPool.h"
+#include <atomic>
+#include <memory>
 #include <random>
 #include <iostream>
 
@@ -35,6 +39,9 @@ namespace EmiROOT {
 
     void setSearchSpace(const SearchSpace&);
 
+    /// Return the search space, with the statistics of the random points
+    const SearchSpace& getSearchSpace() const {return m_search_space;}
+
     /// Set the seed for the random generator
     void setSeed(uint64_t);
 
@@ -58,25 +65,90 @@ namespace EmiROOT {
 
     void setInitialPopulation(const PopulationState&);
 
+    /// Set the maximum number of cost evaluations (0 for no limit) and reset the counter
+    void setMaxEvaluations(std::size_t t) {m_max_evaluations = t; m_n_evaluations = 0;};
+
+    /// Return the number of cost evaluations performed so far
+    std::size_t getNEvaluations() const {return m_n_evaluations;};
+
+    /// Return true if the budget of cost evaluations is exhausted
+    bool isBudgetExhausted() const {return m_max_evaluations > 0 && m_n_evaluations >= m_max_evaluations;};
+
+    /// Return the number of cost evaluations left in the budget
+    std::size_t getRemainingEvaluations() const;
+
+    /// Set the number of threads evaluating the cost of the individuals.
+    /// With more than one thread the objective function is called concurrently.
+    void setNThreads(std::size_t);
+
+    /// Return the number of threads evaluating the cost of the individuals
+    std::size_t getNThreads() const {return m_pool ? m_pool->getNThreads() : 1;};
+
+    /// Set the incremental form of the objective function and the maximum
+    /// number of changed coordinates for which it is used
+    void setDeltaFunction(const DeltaFunction&, std::size_t);
+
+    /// Set the profiler collecting the timing of the phases (nullptr to disable)
+    void setProfiler(Profiler* t) {m_profiler = t;};
+
     virtual Individual* getBestSolution() {return nullptr;};
 
     virtual std::size_t getSize() {return 0;};
 
+    virtual Individual* getIndividual(std::size_t) {return nullptr;};
+
   protected:
 
-    bool ckeckViolateConstraints(std::vector<double>&);
+    bool ckeckViolateConstraints(const std::vector<double>&);
 
-    double constraintsPenaltyMethod(std::vector<double>&);
+    /// Return the cost with the penalty for the violated constraints,
+    /// setting the total violation
+    double constraintsPenaltyMethod(const std::vector<double>&, double&);
 
-    double constraintsBarrierMethod(std::vector<double>&);
+    double constraintsBarrierMethod(const std::vector<double>&);
 
     void checkBoundary(Individual&);
 
+    /// Check the boundaries drawing the random numbers from the given
+    /// generator, so that it can be called concurrently
+    void checkBoundary(Individual&, Random&);
+
+    /// Check the boundaries of one coordinate only, as above. With
+    /// constraints and the DIS method the whole point is regenerated.
+    void checkBoundary(Individual&, std::size_t, Random&);
+
+    /// Return true if checkBoundary(Individual&, Random&) and evaluateCost can
+    /// be called concurrently, i.e. no point has to be regenerated from the
+    /// search space because it violates the constraints
+    bool canEvaluateConcurrently() const;
+
+    /// Evaluate the cost of a point. It can be called concurrently if
+    /// canEvaluateConcurrently() is true.
     double evaluateCost(Point&);
 
+    /// Evaluate the cost of a point, setting the total violation of the
+    /// constraints included in it by the penalty method (0 otherwise)
+    double evaluateCost(Point&, double&);
+
+    /// Evaluate the cost of a point obtained by changing some coordinates
+    /// of a parent with the given cost, setting the violation as above.
+    /// The delta function is used if set and if few enough coordinates
+    /// changed, the full cost otherwise.
+    double evaluateCost(Point&, const Point&, double, double&);
+
+    /// Evaluate the cost of a point which differs from a point with the
+    /// given cost only in the specified coordinate, whose value there was
+    /// the given one, setting the violation as above
+    double evaluateCost(Point&, std::size_t, double, double, double&);
+
+    /// Round the integer parameters, keeping them within the boundaries
+    void roundIntegerParameters(Point&);
+
     Random          m_random;
     SearchSpace     m_search_space;
     Function        m_obj_func;
+    DeltaFunction   m_delta_func;
+    std::size_t     m_delta_max_changed;
     Constraints     m_constraints;
     OOBMethod       m_oob_sol;
     bool            m_maximization;
@@ -86,6 +158,18 @@ namespace EmiROOT {
     double          m_max_penalty_param;
     std::string     m_constrained_method;
     bool            m_silent;
+    Profiler*       m_profiler;
+    std::atomic<std::size_t>    m_n_evaluations;   /**< Number of cost evaluations */
+    std::size_t                 m_max_evaluations; /**< Maximum number of cost evaluations, 0 for no limit */
+    std::shared_ptr<ThreadPool> m_pool;            /**< Threads evaluating the cost, null if serial */
+
+  private:
+    /// Check the boundaries; the random numbers are drawn from the given
+    /// generator or, if null, from the ones of the population
+    void applyBoundaryConditions(Individual&, Random*);
+
+    /// Check the boundaries of the specified coordinate, as above
+    void applyBoundaryCondition(Individual&, std::size_t, Random*);
   };
 
 }
@@ -0,0 +1,184 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_PopulationBase_h
+#define EmiROOT_PopulationBase_h
+
+#include "Ordering.h"
+#include "Population.h"
+#include <algorithm>
+
+namespace EmiROOT {
+
+  /// Base of the populations of the algorithms (CRTP). It holds the
+  /// individuals, the best solution and the configuration, and implements
+  /// the evaluation of the individuals. After the cost of an individual is
+  /// evaluated Derived::track is called, so populations keeping records
+  /// other than the best solution (leaders, personal bests) only need to
+  /// hide track; the call is resolved at compile time.
+  template<typename Derived, typename IndividualT, typename ConfigT>
+  class PopulationBase : public Population {
+  public:
+    PopulationBase(Function t) : Population(t) {}
+
+    void setConfig(const ConfigT& t) {m_config = t;}
+
+    ConfigT& getConfig() {return m_config;}
+
+    /// Access the specified individual
+    IndividualT& operator[](std::size_t t) {return m_individuals[t];}
+
+    /// Return the position of all individuals
+    std::vector<std::vector<double> > getPopulationPosition() {
+      std::vector<std::vector<double> > positions(m_individuals.size());
+      for (std::size_t i = 0; i < m_individuals.size(); ++i) positions[i] = static_cast<const IndividualT&>(m_individuals[i]).getPosition();
+      return positions;
+    }
+
+    /// Return the size of the population
+    std::size_t getSize() {return m_individuals.size();}
+
+    /// Return the specified individual of the population
+    IndividualT* getIndividual(std::size_t t) {return &m_individuals[t];}
+
+    /// Return the best individual
+    IndividualT* getBestSolution() {return &m_best_solution;}
+
+    /// Evaluate the cost of the individuals that changed since their last
+    /// evaluation, within the budget of evaluations
+    void evaluate() {
+      for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+        if (m_individuals[i].isEvaluated()) continue;
+        if (isBudgetExhausted()) break;
+        evaluate(m_individuals[i]);
+      }
+    }
+
+    /// Evaluate the cost of an individual and keep track of the best solution
+    void evaluate(IndividualT& t) {
+      evaluateInto(t);
+      static_cast<Derived*>(this)->track(t);
+    }
+
+    /// Evaluate the cost of an individual obtained by changing a few
+    /// coordinates of parent. If the cost of parent is not up to date
+    /// the full cost is evaluated.
+    void evaluate(IndividualT& t, const IndividualT& parent) {
+      evaluateInto(t, parent);
+      static_cast<Derived*>(this)->track(t);
+    }
+
+    /// Scale the penalty coefficient and return its change. The cost of
+    /// the individuals that are not evaluated again is updated with their
+    /// cached violation. Populations keeping other costs (a sorted memory,
+    /// copies of the best individuals) hide this method, call it and
+    /// update them with rescalePenalty.
+    double scalePenaltyCoeff() {
+      double old_coeff = m_penalty_coeff;
+      Population::scalePenaltyCoeff();
+      double delta = m_penalty_coeff - old_coeff;
+      if (delta != 0.) rescalePenalty(m_individuals, delta);
+      return delta;
+    }
+
+    /// Sort the individuals by increasing cost. The keys are sorted
+    /// first, then each individual is moved once to its place.
+    void sort() {
+      EMIROOT_PROFILE(m_profiler, SORT);
+      m_order.set(m_individuals);
+      m_order.sort();
+      m_order.permute(m_individuals);
+    }
+
+  protected:
+    /// Set the positions provided by the user to the first individuals
+    /// and return how many were set. The positions in excess of the size
+    /// of the population are ignored. The initial design of the search
+    /// space is started for the other individuals, which are generated
+    /// with getRandom().
+    std::size_t loadInitialPopulation() {
+      std::size_t n = std::min((std::size_t) m_initial_population.size(), m_individuals.size());
+      for (std::size_t i = 0; i < n; ++i) {
+        m_individuals[i].setPosition(m_initial_population[i]);
+      }
+      m_search_space.startInitialDesign(m_individuals.size() - n);
+      return n;
+    }
+
+    /// Call f(i) for i in [0, n), on the threads of the population when
+    /// the objective function can be evaluated concurrently. Each call
+    /// must only change the state of item i, read the state shared with
+    /// the other items, which does not change until forEach returns, and
+    /// draw from a random stream of item i instead of m_random: the result
+    /// is then the same for any number of threads. The best solution is
+    /// tracked by the caller after forEach returns.
+    template<typename F>
+    void forEach(std::size_t n, F&& f) {
+      if (m_pool && canEvaluateConcurrently()) {
+        m_pool->parallelFor(n, f);
+      } else {
+        for (std::size_t i = 0; i < n; ++i) f(i);
+      }
+    }
+
+    /// Evaluate the cost of an individual without tracking the best
+    /// solution, so that it can be called within forEach
+    void evaluateInto(Individual& t) {
+      double violation;
+      double cost = evaluateCost(t.getPosition(), violation);
+      t.setCost(cost, violation);
+    }
+
+    /// Evaluate the cost of an individual obtained by changing a few
+    /// coordinates of parent, without tracking the best solution
+    void evaluateInto(Individual& t, const Individual& parent) {
+      if (!parent.isEvaluated()) {
+        evaluateInto(t);
+        return;
+      }
+      double violation;
+      double cost = evaluateCost(t.getPosition(), parent.getPosition(), parent.getCost(), violation);
+      t.setCost(cost, violation);
+    }
+
+    /// Add the change of the penalty coefficient times the cached
+    /// violation to the cost of the evaluated individuals
+    void rescalePenalty(std::vector<IndividualT>& t, double delta) {
+      EMIROOT_PROFILE(m_profiler, PENALTY);
+      for (IndividualT& x : t) {
+        if (x.isEvaluated() && x.getViolation() > 0.) x.setCost(x.getCost() + delta*x.getViolation(), x.getViolation());
+      }
+    }
+
+    /// Update the best solution with a newly evaluated individual
+    void track(IndividualT& t) {
+      if (t.getCost() < m_best_solution.getCost()) {
+        if (ckeckViolateConstraints(static_cast<const IndividualT&>(t).getPosition()) == false) {
+          m_best_solution = t;
+        }
+      }
+    }
+
+    ConfigT                  m_config;        /**< Configuration */
+    std::vector<IndividualT> m_individuals;   /**< Individuals in the population */
+    IndividualT              m_best_solution; /**< Best individual found so far */
+    Ordering                 m_order;         /**< Ranking of the individuals by cost */
+  };
+
+}
+#endif
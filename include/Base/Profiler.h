@@ -0,0 +1,151 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_Profiler_h
+#define EmiROOT_Profiler_h
+
+#include "Results.h"
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+// The instrumentation is compiled only when EMIROOT_PROFILING is defined
+// (cmake -DEMIROOT_PROFILING=ON), otherwise the macros expand to nothing
+#ifdef EMIROOT_PROFILING
+#define EMIROOT_PROFILE_CONCAT_(a, b) a##b
+#define EMIROOT_PROFILE_CONCAT(a, b) EMIROOT_PROFILE_CONCAT_(a, b)
+#define EMIROOT_PROFILE(profiler, phase) EmiROOT::ScopedTimer EMIROOT_PROFILE_CONCAT(emiroot_timer_, __LINE__)(profiler, EmiROOT::Profiler::phase)
+#define EMIROOT_PROFILE_BEGIN(timer, profiler, phase) EmiROOT::ScopedTimer timer(profiler, EmiROOT::Profiler::phase)
+#define EMIROOT_PROFILE_END(timer) timer.stop()
+#define EMIROOT_PROFILE_ITERATION(profiler, evaluations) (profiler)->endIteration(evaluations)
+#else
+#define EMIROOT_PROFILE(profiler, phase)
+#define EMIROOT_PROFILE_BEGIN(timer, profiler, phase)
+#define EMIROOT_PROFILE_END(timer)
+#define EMIROOT_PROFILE_ITERATION(profiler, evaluations)
+#endif
+
+namespace EmiROOT {
+
+  /// Accumulates the time spent in each phase of a minimization.
+  /// Phases can be nested: the time of a phase does not include the time
+  /// of the phases opened inside it, so that the phases sum up to the total.
+  /// When the cost is evaluated by several threads the time of a phase is
+  /// summed over the threads (CPU time); the time spent by the thread that
+  /// started the profiler is kept apart, so that the wall time can be split.
+  class Profiler {
+  public:
+    using Clock = std::chrono::steady_clock;
+
+    enum Phase {
+      INITIALIZATION, /**< Creation and first evaluation of the population */
+      PENALTY,        /**< Scaling of the penalty coefficient */
+      MOVE,           /**< Algorithm specific update of the population */
+      BOUNDARY,       /**< Treatment of the out-of-bound solutions */
+      EVALUATION,     /**< Cost evaluation, excluding objective and constraints */
+      OBJECTIVE,      /**< Calls to the objective function */
+      CONSTRAINTS,    /**< Calls to the constraint functions */
+      SORT,           /**< Sorting of the population */
+      HISTORY,        /**< Update of the cost and population history */
+      N_PHASES
+    };
+
+    Profiler();
+
+    /// Reset the counters and start the clock from the calling thread.
+    /// The storage for the timing of the expected number of iterations
+    /// is reserved upfront.
+    void start(std::size_t t_iterations = 0);
+
+    /// Stop the clock
+    void stop();
+
+    /// Return the time since start() [s]
+    double getElapsedTime() const {return std::chrono::duration<double>(Clock::now() - m_start).count();}
+
+    /// Mark the end of an iteration, given the number of cost evaluations performed so far
+    void endIteration(std::size_t);
+
+    /// Add a time interval [ns] to a phase
+    void add(Phase t_phase, int64_t t_ns, std::size_t t_calls = 1) {
+      m_time[t_phase].fetch_add(t_ns, std::memory_order_relaxed);
+      m_calls[t_phase].fetch_add(t_calls, std::memory_order_relaxed);
+      if (std::this_thread::get_id() == m_thread) m_thread_time[t_phase] += t_ns;
+    }
+
+    /// Summary of the last minimization
+    PerformanceReport getReport() const;
+
+    static const char* getPhaseName(Phase);
+
+  private:
+    std::atomic<int64_t>     m_time[N_PHASES];        /**< Exclusive time of each phase, summed over the threads [ns] */
+    std::atomic<std::size_t> m_calls[N_PHASES];
+    int64_t                  m_thread_time[N_PHASES]; /**< Exclusive time of each phase in the thread calling start() [ns] */
+    std::thread::id          m_thread;                /**< Thread that called start() */
+    Clock::time_point        m_start;
+    Clock::time_point        m_stop;
+    Clock::time_point        m_last_iteration;
+    std::size_t              m_last_evaluations;
+    std::vector<double>      m_iteration_times;
+    std::vector<std::size_t> m_iteration_evaluations;
+  };
+
+
+  /// Times a phase for the lifetime of the object. A null profiler
+  /// disables the timer.
+  class ScopedTimer {
+  public:
+    ScopedTimer(Profiler* t_profiler, Profiler::Phase t_phase) :
+    m_profiler(t_profiler),
+    m_phase(t_phase),
+    m_children(0) {
+      if (!m_profiler) return;
+      m_parent  = s_current;
+      s_current = this;
+      m_start   = Profiler::Clock::now();
+    }
+
+    ~ScopedTimer() {stop();}
+
+    /// Stop the timer before the end of the scope. Timers must be
+    /// stopped in the reverse order they were started.
+    void stop() {
+      if (!m_profiler) return;
+      int64_t elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(Profiler::Clock::now() - m_start).count();
+      m_profiler->add(m_phase, elapsed - m_children);
+      s_current = m_parent;
+      if (m_parent) m_parent->m_children += elapsed;
+      m_profiler = nullptr;
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+  private:
+    Profiler*                    m_profiler;
+    Profiler::Phase              m_phase;
+    ScopedTimer*                 m_parent;
+    int64_t                      m_children;  /**< Time spent in nested phases [ns] */
+    Profiler::Clock::time_point  m_start;
+    static thread_local ScopedTimer* s_current; /**< Innermost open timer of the thread */
+  };
+
+}
+#endif
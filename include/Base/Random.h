@@ -46,6 +46,11 @@ namespace EmiROOT {
     /// Returns a vector of double numbers in [a, b]
     std::vector<double> randVector(std::size_t, double, double);
 
+    /// Fills an array with n double numbers in [0, 1], the same that n
+    /// calls of rand() would return. The numbers of the sequence do not
+    /// depend on each other, so the loop is vectorized.
+    void fill(double*, std::size_t);
+
     /// Returns an unsigned integer number in [a, b)
     uint64_t randUInt(uint64_t, uint64_t);
 
@@ -55,6 +60,15 @@ namespace EmiROOT {
     /// Returns a normal distributed random number with specified mean and stardard deviation
     double norm(double, double);
 
+    /// Fills an array with n standard normal distributed numbers, the same
+    /// that n calls of norm() would return. The uniform numbers are drawn
+    /// in blocks with fill.
+    void fillNorm(double*, std::size_t);
+
+    /// Returns a generator seeded with the next number of the sequence, used
+    /// to give an independent stream to each task of a parallel loop
+    Random split();
+
   private:
     uint64_t next();
     double toDouble(uint64_t x);
@@ -20,12 +20,44 @@
 #define EmiROOT_Results_h
 
 #include "Types.h"
+#include "Constraint.h"
 
 namespace EmiROOT {
 
+  /// Time spent in a phase of the minimization
+  struct PhaseTiming {
+    std::string name;  /**< Name of the phase */
+    double      time;  /**< Time spent in the phase, excluding nested phases [s] */
+    std::size_t calls; /**< Number of times the phase was entered */
+  };
+
+  /// Breakdown of the time spent by the minimization. The per-phase timing
+  /// is available only when EmiROOT is compiled with EMIROOT_PROFILING,
+  /// otherwise only the total time is filled and enabled is false.
+  struct PerformanceReport {
+    bool                     enabled;
+    double                   total_time;            /**< Wall time of minimize() [s] */
+    double                   objective_time;        /**< CPU time spent in the objective function, summed over the threads [s] */
+    double                   constraint_time;       /**< CPU time spent in the constraint functions, summed over the threads [s] */
+    double                   framework_time;        /**< Wall time spent in EmiROOT itself, outside the user functions of the calling thread [s] */
+    std::size_t              evaluations;           /**< Number of cost evaluations, as in OptimizationResults */
+    std::vector<PhaseTiming> phases;                /**< Per-phase breakdown, summed over the threads */
+    std::vector<double>      iteration_times;       /**< Wall time of each iteration, the first being the initialization [s] */
+    std::vector<std::size_t> iteration_evaluations; /**< Number of cost evaluations in each iteration */
+  };
+
+  /// Statistics of the random points drawn in the search space, for the
+  /// initial population and for the points regenerated afterwards
+  struct SamplingReport {
+    std::size_t generated;  /**< Number of points drawn */
+    std::size_t rejected;   /**< Number of points rejected because they violate the constraints */
+    std::size_t infeasible; /**< Number of points kept violating the constraints after the maximum number of trials */
+  };
+
   struct OptimizationResults {
     std::string algorithm;
     std::size_t iterations;
+    std::size_t evaluations;
     std::size_t population_size;
     Function obj_function;
     Constraints constraints;
@@ -36,6 +68,8 @@ namespace EmiROOT {
     ParametersName parameter_names;
     CostHistory cost_history;
     bool is_maximization;
+    PerformanceReport performance;
+    SamplingReport sampling;
   };
 
 }
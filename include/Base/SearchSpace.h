@@ -21,6 +21,7 @@
 
 #include "Parameter.h"
 #include "Constraint.h"
+#include "InitialDesign.h"
 #include "Random.h"
 
 namespace EmiROOT {
@@ -42,16 +43,40 @@ namespace EmiROOT {
 
     void setConstraints(const Constraints&);
 
+    /// Generate only points satisfying the constraints
     void setCostrInitPop(bool);
 
+    /// Set the maximum number of points drawn to find one satisfying the
+    /// constraints (10000 by default). When it is reached the point with
+    /// the smallest violation is returned.
+    void setCostrInitPopMaxTrials(std::size_t);
+
+    /// Set the design of the initial population (UNIFORM by default)
+    void setInitialDesign(InitialDesignType);
+
+    /// Start the initial design: the next n points returned by getRandom()
+    /// are taken from it, then the points are uniform again
+    void startInitialDesign(std::size_t);
+
     /// Return the number of parameters
     std::size_t getNumberOfParameters() const;
 
     /// Return the specified component a random point in the search space
     double getRandom(std::size_t);
 
-    /// Return a random point in the search space
-    Point getRandom();
+    /// Return a random point in the search space. The point is
+    /// overwritten by the next call.
+    const Point& getRandom();
+
+    /// Return the number of points returned by getRandom()
+    std::size_t getNGenerated() const {return m_n_generated;}
+
+    /// Return the number of points rejected because they violate the constraints
+    std::size_t getNRejected() const {return m_n_rejected;}
+
+    /// Return the number of points returned violating the constraints,
+    /// after the maximum number of trials
+    std::size_t getNInfeasible() const {return m_n_infeasible;}
 
     /// Access the specified parameter
     Parameter &operator[](std::size_t t) { return m_par[t]; };
@@ -60,13 +85,25 @@ namespace EmiROOT {
     double rand();
 
   private:
-    bool ckeckConstraint();
+    /// Return true if the generated point violates any constraint, and the
+    /// sum of the absolute values of the violated constraints
+    bool ckeckConstraint(double&);
+
+    /// Draw a point, from the initial design if it is started
+    void generatePoint();
 
     std::vector<Parameter> m_par;
     Random                 m_random;
     Constraints            m_constraints;
     Point                  m_gen_point;
     bool                   m_constr_init_pop;
+    std::size_t            m_max_trials;    /**< Maximum number of points drawn to satisfy the constraints */
+    Point                  m_best_point;    /**< Point with the smallest violation among the rejected ones */
+    InitialDesign          m_design;        /**< Design of the initial population */
+    std::size_t            m_design_left;   /**< Number of points still to take from the design */
+    std::size_t            m_n_generated;   /**< Number of points returned */
+    std::size_t            m_n_rejected;    /**< Number of points rejected by the constraints */
+    std::size_t            m_n_infeasible;  /**< Number of points returned violating the constraints */
   };
 
 }
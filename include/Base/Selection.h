@@ -0,0 +1,77 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_Selection_h
+#define EmiROOT_Selection_h
+
+#include <vector>
+#include <cstddef>
+
+namespace EmiROOT {
+
+  /// Fitness-proportional (roulette wheel) selection on a table of cumulative
+  /// probabilities. The table is built in O(N) and every draw is a binary
+  /// search, O(log N).
+  class RouletteWheel {
+  public:
+    RouletteWheel();
+
+    /// Build the table from non-negative weights, which need not be normalized.
+    /// If all the weights are zero the selection is uniform.
+    void set(const std::vector<double>&);
+
+    /// Return the index selected by a uniform random number in [0, 1]
+    std::size_t select(double) const;
+
+    /// Return the cumulative probability of the first t+1 entries
+    double getCumulative(std::size_t t) const {return m_cumulative[t];}
+
+    /// Return the number of entries of the table
+    std::size_t getSize() const {return m_cumulative.size();}
+
+  private:
+    std::vector<double> m_cumulative; /**< Cumulative probabilities */
+  };
+
+
+  /// Fitness-proportional selection with the alias method of Walker (in the
+  /// formulation of Vose). The table is built in O(N) and every draw costs
+  /// O(1), which pays off when many draws are done on the same table.
+  class AliasTable {
+  public:
+    AliasTable();
+
+    /// Build the table from non-negative weights, which need not be normalized.
+    /// If all the weights are zero the selection is uniform.
+    void set(const std::vector<double>&);
+
+    /// Return the index selected by a uniform random number in [0, 1]
+    std::size_t select(double) const;
+
+    /// Return the number of entries of the table
+    std::size_t getSize() const {return m_prob.size();}
+
+  private:
+    std::vector<double>      m_prob;  /**< Probability of keeping the entry of each bin */
+    std::vector<std::size_t> m_alias; /**< Entry selected when the one of the bin is rejected */
+    std::vector<std::size_t> m_small; /**< Work buffer with the under-full bins */
+    std::vector<std::size_t> m_large; /**< Work buffer with the over-full bins */
+  };
+
+}
+#endif
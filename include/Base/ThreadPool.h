@@ -0,0 +1,83 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_ThreadPool_h
+#define EmiROOT_ThreadPool_h
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace EmiROOT {
+
+  /// Fixed set of worker threads executing the iterations of a loop. The
+  /// calling thread takes part in the work, so a pool of n threads starts
+  /// n-1 workers. Iterations are handed out one at a time, which balances
+  /// objective functions with a variable cost. Running a loop does not
+  /// allocate memory.
+  class ThreadPool {
+  public:
+    ThreadPool(std::size_t);
+
+    ~ThreadPool();
+
+    /// Return the number of threads, including the calling one
+    std::size_t getNThreads() const {return m_workers.size() + 1;}
+
+    /// Call f(i) for i in [0, n) and return when all the calls are done.
+    /// The calls can run concurrently and in any order.
+    template<typename F>
+    void parallelFor(std::size_t n, F& f) {
+      if (m_workers.empty() || n < 2) {
+        for (std::size_t i = 0; i < n; ++i) f(i);
+        return;
+      }
+      run(n, [](void* t, std::size_t i) {(*static_cast<F*>(t))(i);}, &f);
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+  private:
+    typedef void (*Task)(void*, std::size_t);
+
+    void run(std::size_t, Task, void*);
+
+    /// Execute iterations of the current loop until there are none left
+    void work();
+
+    /// Main loop of a worker thread
+    void workerLoop();
+
+    std::vector<std::thread> m_workers;
+    std::mutex               m_mutex;
+    std::condition_variable  m_wake;       /**< Signals a new loop or the shutdown to the workers */
+    std::condition_variable  m_done;       /**< Signals the end of a loop to the calling thread */
+    std::size_t              m_generation; /**< Number of loops started so far */
+    std::size_t              m_busy;       /**< Workers still working on the current loop */
+    bool                     m_stop;
+    Task                     m_task;
+    void*                    m_context;
+    std::size_t              m_n;          /**< Number of iterations of the current loop */
+    std::atomic<std::size_t> m_next;       /**< Next iteration to be executed */
+  };
+
+}
+#endif
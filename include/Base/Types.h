@@ -20,6 +20,8 @@
 #define EmiROOT_Types_h
 
 #include <functional>
+#include <limits>
+#include <string>
 #include <vector>
 
 namespace EmiROOT {
@@ -43,7 +45,12 @@ namespace EmiROOT {
   typedef std::vector<double> CostHistory;
 
   /// Function
-  typedef std::function<double(Point)> Function;
+  typedef std::function<double(const Point&)> Function;
+
+  /// Incremental form of a Function. Given the new point, the cost of the
+  /// parent point, the indices of the coordinates that changed and their
+  /// values in the parent, return the cost of the new point.
+  typedef std::function<double(const Point&, double, const std::vector<std::size_t>&, const std::vector<double>&)> DeltaFunction;
 
   /// - L  : <
   /// - LEQ: <=
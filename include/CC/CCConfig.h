@@ -0,0 +1,104 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_CCConfig_h
+#define EmiROOT_CCConfig_h
+
+#include <Base/Algorithm.h>
+#include <Base/Config.h>
+#include <functional>
+#include <memory>
+
+namespace EmiROOT {
+
+  /// Decomposition of the parameters in groups:
+  /// - STATIC_GROUPING      : consecutive parameters, in groups of the given size
+  /// - RANDOM_GROUPING      : random groups of the given size, drawn again at each cycle
+  /// - DIFFERENTIAL_GROUPING: groups of interacting parameters, learnt at the
+  ///                          start by differential grouping; the separable
+  ///                          parameters and the small groups are packed in
+  ///                          groups of about the given size
+  enum CCGrouping {STATIC_GROUPING, RANDOM_GROUPING, DIFFERENTIAL_GROUPING};
+
+  /// Factory of the algorithm optimizing a group, given the objective
+  /// function of the group and its budget of evaluations
+  typedef std::function<std::unique_ptr<Algorithm>(const Function&, std::size_t)> CCOptimizer;
+
+  /// Return a factory of AlgorithmT with the given configuration, whose
+  /// budget of evaluations is set to the one of the group. If the maximum
+  /// number of iterations is not set the budget bounds it.
+  template<typename AlgorithmT, typename ConfigT>
+  CCOptimizer makeCCOptimizer(const ConfigT& t_config) {
+    return [t_config](const Function& f, std::size_t max_evaluations) {
+      ConfigT config = t_config;
+      config.setMaxEvaluations(max_evaluations);
+      if (config.getNMaxIterations() == 0) config.setNMaxIterations(max_evaluations);
+      return std::unique_ptr<Algorithm>(new AlgorithmT(f, config));
+    };
+  }
+
+  class CCConfig : public Config {
+  public:
+    /// CCConfig default constructor
+    CCConfig();
+
+    /// Set the factory of the algorithm optimizing each group
+    void setOptimizer(const CCOptimizer&);
+
+    /// Set the decomposition of the parameters (STATIC_GROUPING by default)
+    void setGrouping(CCGrouping);
+
+    /// Set the size of the groups (20 by default)
+    void setGroupSize(std::size_t);
+
+    /// Set the budget of evaluations of a group at each cycle, per
+    /// parameter of the group (400 by default)
+    void setGroupBudget(std::size_t);
+
+    /// Set the threshold on the interaction of two parameters of the
+    /// differential grouping (1e-3 by default)
+    void setGroupingThreshold(double);
+
+    /// Optimize the groups of a cycle against the same context vector
+    /// and merge their results, instead of one after the other (false by
+    /// default). The groups are then optimized concurrently with setNThreads.
+    void setConcurrentGroups(bool);
+
+    const CCOptimizer& getOptimizer() const;
+
+    CCGrouping getGrouping() const;
+
+    std::size_t getGroupSize() const;
+
+    std::size_t getGroupBudget() const;
+
+    double getGroupingThreshold() const;
+
+    bool isConcurrentGroups() const;
+
+  private:
+    CCOptimizer m_optimizer;    /**< Factory of the algorithm optimizing a group */
+    CCGrouping  m_grouping;     /**< Decomposition of the parameters */
+    std::size_t m_group_size;   /**< Size of the groups */
+    std::size_t m_group_budget; /**< Evaluations per parameter of a group at each cycle */
+    double      m_threshold;    /**< Interaction threshold of the differential grouping */
+    bool        m_concurrent;   /**< True if the groups of a cycle share the context vector */
+  };
+
+}
+#endif
@@ -0,0 +1,82 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_CCPopulation_h
+#define EmiROOT_CCPopulation_h
+
+#include <Base/Individual.h>
+#include "CCConfig.h"
+#include <Base/PopulationBase.h>
+
+namespace EmiROOT {
+
+  /// Population of the cooperative co-evolution. Its only individual is
+  /// the context vector, the best point found so far. At each cycle every
+  /// group of parameters is optimized by its own algorithm, on the
+  /// objective function in which the other parameters are fixed to the
+  /// context vector, and the context vector takes the best point of each
+  /// group that improves it. The evaluations of the groups are counted in
+  /// the budget of the population.
+  class CCPopulation : public PopulationBase<CCPopulation, Individual, CCConfig> {
+  public:
+
+    //// Common methods ///////////////////////////////////////
+    CCPopulation(Function);
+
+    void init();
+
+    ///////////////////////////////////////////////////////////
+
+    //// Specific methods /////////////////////////////////////
+    /// Build the groups. The differential grouping spends 1 + d + d(d-1)/2
+    /// evaluations; if they are more than half of the budget the static
+    /// grouping is used instead.
+    void makeGroups();
+
+    /// Optimize each group once, drawing again the random groups first
+    void optimizeGroups();
+
+    /// Return the groups of parameters
+    const std::vector<std::vector<std::size_t> >& getGroups() const {return m_groups;}
+
+  private:
+    /// Split the given parameters in consecutive groups of the configured size
+    void splitGroups(const std::vector<std::size_t>&);
+
+    /// Differential grouping of the parameters, testing all the pairs
+    void learnGroups();
+
+    /// Optimize a group against the given context vector, with the given
+    /// budget, seed and number of threads, storing its best point and cost
+    void optimizeGroup(std::size_t, std::size_t, uint64_t, std::size_t, const Point&);
+
+    /// Copy the best point of a group in the given point
+    void insertGroup(std::size_t, Point&) const;
+
+    std::vector<std::vector<std::size_t> > m_groups;     /**< Indices of the parameters of each group */
+    std::vector<Point>                     m_group_best; /**< Best point of each group at the last cycle */
+    std::vector<double>                    m_group_cost; /**< Cost of the best point of each group */
+    std::vector<std::size_t>               m_budgets;    /**< Budget of each group at the current cycle */
+    std::vector<uint64_t>                  m_seeds;      /**< Seed of the algorithm of each group at the current cycle */
+    std::vector<std::size_t>               m_order_par;  /**< Parameters in the order of the random grouping */
+    Point                                  m_merged;     /**< Context vector with the results of all the groups */
+    std::string                            m_oob;        /**< Name of the method for the out-of-bound solutions */
+  };
+
+}
+#endif
@@ -0,0 +1,50 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_CC_algorithm_h
+#define EmiROOT_CC_algorithm_h
+
+#include <Base/AlgorithmBase.h>
+#include "CCConfig.h"
+#include "CCPopulation.h"
+
+namespace EmiROOT {
+
+  /// Cooperative co-evolution: the parameters are split in groups, each
+  /// one optimized in turn by the algorithm given by
+  /// CCConfig::setOptimizer against a shared context vector. An iteration
+  /// is a cycle over all the groups.
+  class CC_algorithm : public AlgorithmBase<CC_algorithm, CCPopulation, CCConfig> {
+  public:
+    CC_algorithm(const Function&, const CCConfig&);
+
+  private:
+    friend class AlgorithmBase<CC_algorithm, CCPopulation, CCConfig>;
+
+    /// Evaluate the context vector and build the groups
+    void initialize();
+
+    /// Optimize each group once
+    void step();
+  };
+
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<CC_algorithm, CCPopulation, CCConfig>;
+
+}
+#endif
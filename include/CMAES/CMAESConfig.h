@@ -0,0 +1,70 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_CMAESConfig_h
+#define EmiROOT_CMAESConfig_h
+
+#include <Base/Config.h>
+#include <cstddef>
+
+namespace EmiROOT {
+
+  /// Restart strategy of CMA-ES, applied when the distribution converged
+  /// or became ill-conditioned:
+  /// - NO_RESTART: the run continues with the converged distribution
+  /// - IPOP      : restart from a random mean with a larger population
+  /// - BIPOP     : alternate the IPOP restarts with restarts with a small
+  ///               population and a small step size, choosing the regime
+  ///               that used fewer evaluations so far
+  enum CMAESRestart {NO_RESTART, IPOP, BIPOP};
+
+  class CMAESConfig : public Config {
+  public:
+    /// CMAESConfig default constructor
+    CMAESConfig();
+
+    /// Set the initial step size, as a fraction of the range of the
+    /// parameters (0.3 by default)
+    void setSigma(double);
+
+    /// Set the restart strategy (IPOP by default)
+    void setRestartStrategy(CMAESRestart);
+
+    /// Set the factor multiplying the population at each IPOP restart (2 by default)
+    void setIncPopSize(double);
+
+    /// Set the maximum number of restarts (9 by default)
+    void setNMaxRestarts(std::size_t);
+
+    double getSigma() const;
+
+    CMAESRestart getRestartStrategy() const;
+
+    double getIncPopSize() const;
+
+    std::size_t getNMaxRestarts() const;
+
+  private:
+    double       m_sigma;          /**< Initial step size in units of the range of the parameters */
+    CMAESRestart m_restart;        /**< Restart strategy */
+    double       m_inc_pop_size;   /**< Growth factor of the population at each restart */
+    std::size_t  m_n_max_restarts; /**< Maximum number of restarts */
+  };
+
+}
+#endif
@@ -0,0 +1,132 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_CMAESPopulation_h
+#define EmiROOT_CMAESPopulation_h
+
+#include <Base/Individual.h>
+#include "CMAESConfig.h"
+#include <Base/PopulationBase.h>
+
+namespace EmiROOT {
+
+  /// Population of the covariance matrix adaptation evolution strategy.
+  /// The individuals of a generation are sampled from a multivariate
+  /// normal distribution whose mean, step size and covariance matrix are
+  /// adapted from the best half of them. The distribution lives in the
+  /// unit cube, each parameter being scaled by its range, so that the
+  /// initial step size is the same fraction of every range.
+  class CMAESPopulation : public PopulationBase<CMAESPopulation, Individual, CMAESConfig> {
+  public:
+
+    //// Common methods ///////////////////////////////////////
+    CMAESPopulation(Function);
+
+    void init();
+
+    ///////////////////////////////////////////////////////////
+
+    //// Specific methods /////////////////////////////////////
+    /// Set the initial distribution, centred on the weighted mean of the
+    /// best individuals of the evaluated initial population
+    void initDistribution();
+
+    /// Sample and evaluate a generation. The distribution is only read,
+    /// and each individual draws from its own random stream.
+    void sampleGeneration();
+
+    /// Update the mean, the evolution paths, the covariance matrix and
+    /// the step size from the ranking of the generation. The covariance
+    /// matrix is decomposed again only every few generations.
+    void updateDistribution();
+
+    /// Return true if the distribution converged or became ill-conditioned
+    bool isConverged() const {return m_converged;}
+
+    /// Restart the distribution from a random mean, with the population
+    /// size and step size given by the restart strategy. Nothing is done
+    /// if the strategy is NO_RESTART or the maximum number of restarts
+    /// was reached.
+    void restart();
+
+    /// Return the current step size, in units of the range of the parameters
+    double getSigma() const {return m_sigma;}
+
+    /// Return the number of restarts done so far
+    std::size_t getNRestarts() const {return m_n_restarts;}
+
+  private:
+    /// Set the size of the population and the strategy parameters
+    /// depending on it, and reset the distribution to the given mean and step size
+    void resetDistribution(std::size_t, double);
+
+    /// Eigendecomposition of the covariance matrix with the cyclic Jacobi method
+    void decompose();
+
+    /// Check the termination criteria of the current run
+    void checkConvergence(double, double);
+
+    std::size_t         m_lambda;          /**< Size of the current population */
+    std::size_t         m_lambda0;         /**< Size of the initial population */
+    std::size_t         m_mu;              /**< Number of individuals selected for the update */
+    std::vector<double> m_weights;         /**< Recombination weights of the selected individuals */
+    double              m_mueff;           /**< Variance effective selection mass */
+    double              m_cs;              /**< Learning rate of the step size path */
+    double              m_ds;              /**< Damping of the step size */
+    double              m_cc;              /**< Learning rate of the covariance path */
+    double              m_c1;              /**< Learning rate of the rank-one update */
+    double              m_cmu;             /**< Learning rate of the rank-mu update */
+    double              m_chi_n;           /**< Expected norm of a standard normal vector */
+    std::size_t         m_eigen_gap;       /**< Generations between two eigendecompositions */
+
+    std::vector<double> m_lower;           /**< Lower boundary of the parameters */
+    std::vector<double> m_range;           /**< Range of the parameters */
+    std::vector<double> m_mean;            /**< Mean of the distribution */
+    std::vector<double> m_ps;              /**< Evolution path of the step size */
+    std::vector<double> m_pc;              /**< Evolution path of the covariance matrix */
+    std::vector<double> m_C;               /**< Covariance matrix, upper triangle only */
+    std::vector<double> m_B;               /**< Eigenvectors of the covariance matrix, by column */
+    std::vector<double> m_D;               /**< Square root of the eigenvalues */
+    std::vector<double> m_BD;              /**< Product of B and diag(D), which maps the samples */
+    std::vector<double> m_work;            /**< Work matrix of the eigendecomposition */
+    std::vector<double> m_noise;           /**< Standard normal samples, one row per individual */
+    std::vector<double> m_steps;           /**< Steps of the individuals from the mean in units of sigma */
+    std::vector<double> m_weighted;        /**< Weighted steps of the selected individuals */
+    std::vector<double> m_yw;              /**< Weighted mean of the selected steps */
+    std::vector<double> m_tmp;             /**< Work vector */
+    std::vector<Random> m_individual_random; /**< Random stream of each individual */
+    double              m_sigma;           /**< Step size */
+    double              m_sigma0;          /**< Initial step size of the current run */
+    std::size_t         m_generation;      /**< Generations of the current run */
+    std::size_t         m_eigen_generation; /**< Generation of the last eigendecomposition */
+    std::size_t         m_n_sampled;       /**< Individuals sampled in the last generation */
+    bool                m_converged;       /**< True if the current run converged */
+
+    std::vector<double> m_history;         /**< Best cost of the last generations */
+    std::size_t         m_n_history;       /**< Number of generations in the history */
+
+    std::size_t         m_n_restarts;      /**< Number of restarts */
+    std::size_t         m_n_large;         /**< Number of runs with a large population after the first */
+    std::size_t         m_evals_large;     /**< Evaluations of the runs with a large population */
+    std::size_t         m_evals_small;     /**< Evaluations of the runs with a small population */
+    std::size_t         m_run_start;       /**< Evaluations at the start of the current run */
+    bool                m_small_regime;    /**< True if the current run has a small population */
+  };
+
+}
+#endif
@@ -0,0 +1,46 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_CMAES_algorithm_h
+#define EmiROOT_CMAES_algorithm_h
+
+#include <Base/AlgorithmBase.h>
+#include "CMAESConfig.h"
+#include "CMAESPopulation.h"
+
+namespace EmiROOT {
+
+  class CMAES_algorithm : public AlgorithmBase<CMAES_algorithm, CMAESPopulation, CMAESConfig> {
+  public:
+    CMAES_algorithm(const Function&, const CMAESConfig&);
+
+  private:
+    friend class AlgorithmBase<CMAES_algorithm, CMAESPopulation, CMAESConfig>;
+
+    /// Evaluate the initial population and set the initial distribution
+    void initialize();
+
+    /// Advance the population by one generation
+    void step();
+  };
+
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<CMAES_algorithm, CMAESPopulation, CMAESConfig>;
+
+}
+#endif
@@ -32,13 +32,21 @@ namespace EmiROOT {
 
     void setAlpha(double);
 
+    /// Set the number of cuckoo eggs laid at each iteration (default 1).
+    /// They are laid around the same best nest and evaluated together with
+    /// the abandoned nests.
+    void setNEggs(std::size_t);
+
     double getPa() const;
 
     double getAlpha() const;
 
+    std::size_t getNEggs() const;
+
   private:
-    double m_pa;     /**< Discovery rate */
-    double m_alpha;  /**< Step size */
+    double      m_pa;     /**< Discovery rate */
+    double      m_alpha;  /**< Step size */
+    std::size_t m_n_eggs; /**< Number of eggs laid at each iteration */
   };
 
 }
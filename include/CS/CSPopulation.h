@@ -21,11 +21,11 @@
 
 #include "Nest.h"
 #include "CSConfig.h"
-#include <Base/Population.h>
+#include <Base/PopulationBase.h>
 
 namespace EmiROOT {
 
-  class CSPopulation : public Population {
+  class CSPopulation : public PopulationBase<CSPopulation, Nest, CSConfig> {
   public:
 
     //// Common methods ///////////////////////////////////////
@@ -33,35 +33,22 @@ namespace EmiROOT {
 
     void init();
 
-    void setConfig(const CSConfig&);
-
-    /// Access the specified nest
-    Nest &operator[](std::size_t t) { return m_individuals[t]; };
-
-    /// Return the position of all nests
-    std::vector<std::vector<double> > getPopulationPosition();
-
-    /// Return the size of the population
-    std::size_t getSize() {return m_individuals.size();};
-
-    /// Return the best nest
-    Nest* getBestSolution();
-
-    void evaluate();
-
-    void evaluate(Nest&);
     ///////////////////////////////////////////////////////////
 
     //// Specific methods /////////////////////////////////////
-    void generateCuckooEgg();
 
-    void sort();
+    /// Rank the nests by cost. Only the best nest and the worst ones,
+    /// which are abandoned, are found; the nests are not moved.
+    void rank();
 
+    /// Lay the cuckoo eggs and replace the abandoned nests; the eggs and
+    /// the new nests are evaluated together
+    void generateCuckooEgg();
 
   private:
-    CSConfig          m_config;
-    std::vector<Nest> m_individuals;
-    Nest              m_best_solution; /**< Best nest */
+    std::vector<Nest>        m_eggs;    /**< Eggs laid at each iteration, allocated once */
+    std::vector<std::size_t> m_hosts;   /**< Nest chosen by each egg */
+    std::vector<double>      m_normal;  /**< Normal random numbers of a Lévy flight */
   };
 
 }
@@ -19,25 +19,28 @@
 #ifndef EmiROOT_CS_algorithm_h
 #define EmiROOT_CS_algorithm_h
 
-#include <Base/Algorithm.h>
+#include <Base/AlgorithmBase.h>
 #include "CSConfig.h"
 #include "CSPopulation.h"
 
 namespace EmiROOT {
 
-  class CS_algorithm : public Algorithm {
+  class CS_algorithm : public AlgorithmBase<CS_algorithm, CSPopulation, CSConfig> {
   public:
     CS_algorithm(const Function&, const CSConfig&);
 
-    void setSeed(uint64_t);
-
-    void minimize();
-
   private:
+    friend class AlgorithmBase<CS_algorithm, CSPopulation, CSConfig>;
 
-    CSConfig m_algo_config;
-    CSPopulation m_population;
+    /// Evaluate the initial population
+    void initialize();
+
+    /// Advance the population by one iteration
+    void step();
   };
 
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<CS_algorithm, CSPopulation, CSConfig>;
+
 }
 #endif
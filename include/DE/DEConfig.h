@@ -0,0 +1,100 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_DEConfig_h
+#define EmiROOT_DEConfig_h
+
+#include <Base/Config.h>
+#include <cstddef>
+
+namespace EmiROOT {
+
+  /// Mutation strategy of the differential evolution:
+  /// - RAND_1            : x_r0 + F (x_r1 - x_r2)
+  /// - BEST_1            : x_best + F (x_r1 - x_r2)
+  /// - CURRENT_TO_PBEST_1: x_i + F (x_pbest - x_i) + F (x_r1 - x_r2), with
+  ///                       x_pbest drawn among the best individuals and x_r2
+  ///                       from the population and the archive of the
+  ///                       replaced parents
+  enum DEStrategy {RAND_1, BEST_1, CURRENT_TO_PBEST_1};
+
+  class DEConfig : public Config {
+  public:
+    /// DEConfig default constructor
+    DEConfig();
+
+    /// Set the mutation strategy (RAND_1 by default)
+    void setStrategy(DEStrategy);
+
+    /// Set the scale factor of the differences (0.5 by default)
+    void setF(double);
+
+    /// Set the crossover rate (0.9 by default)
+    void setCR(double);
+
+    /// Enable the success-history adaptation of F and CR of SHADE (false
+    /// by default). Each individual draws its own F and CR around one of
+    /// the entries of a memory, which is updated with the means of the
+    /// values that improved their parent.
+    void setAdaptive(bool);
+
+    /// Set the number of entries of the memory of SHADE (6 by default)
+    void setMemorySize(std::size_t);
+
+    /// Set the fraction of the population among which x_pbest is drawn (0.11 by default)
+    void setPBest(double);
+
+    /// Set the size of the archive of the replaced parents, in units of
+    /// the population size (2.6 by default, 0 to disable the archive)
+    void setArchiveRate(double);
+
+    /// Set the final size of the population. If it is smaller than the
+    /// initial one the population shrinks linearly with the evaluations
+    /// spent, removing the worst individuals, as in L-SHADE (0 by
+    /// default, for a constant size).
+    void setMinPopulationSize(std::size_t);
+
+    DEStrategy getStrategy() const;
+
+    double getF() const;
+
+    double getCR() const;
+
+    bool isAdaptive() const;
+
+    std::size_t getMemorySize() const;
+
+    double getPBest() const;
+
+    double getArchiveRate() const;
+
+    std::size_t getMinPopulationSize() const;
+
+  private:
+    DEStrategy  m_strategy;     /**< Mutation strategy */
+    double      m_f;            /**< Scale factor */
+    double      m_cr;           /**< Crossover rate */
+    bool        m_adaptive;     /**< True for the success-history adaptation of F and CR */
+    std::size_t m_memory_size;  /**< Number of entries of the memory of F and CR */
+    double      m_pbest;        /**< Fraction of the best individuals for CURRENT_TO_PBEST_1 */
+    double      m_archive_rate; /**< Size of the archive in units of the population size */
+    std::size_t m_min_size;     /**< Final size of the population, 0 for a constant size */
+  };
+
+}
+#endif
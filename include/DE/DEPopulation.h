@@ -0,0 +1,78 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_DEPopulation_h
+#define EmiROOT_DEPopulation_h
+
+#include <Base/Individual.h>
+#include "DEConfig.h"
+#include <Base/PopulationBase.h>
+
+namespace EmiROOT {
+
+  class DEPopulation : public PopulationBase<DEPopulation, Individual, DEConfig> {
+  public:
+
+    //// Common methods ///////////////////////////////////////
+    DEPopulation(Function);
+
+    void init();
+
+    ///////////////////////////////////////////////////////////
+
+    //// Specific methods /////////////////////////////////////
+    /// Generate and evaluate the trial vectors of a generation by mutation
+    /// and crossover. The population and the archive are only read, and
+    /// each individual draws its donors, F and CR from its own random stream.
+    void generateTrials();
+
+    /// Replace each individual by its trial if this is not worse, archive
+    /// the replaced parents and update the memory of F and CR
+    void selectSurvivors();
+
+    /// Remove the worst individuals following the linear reduction of the
+    /// population size, if enabled
+    void reducePopulation(std::size_t);
+
+  private:
+    /// Draw an index in [0, n) different from the given ones
+    std::size_t drawIndex(Random&, std::size_t, std::size_t, std::size_t, std::size_t) const;
+
+    /// Add a parent replaced by its trial to the archive
+    void archive(const Individual&);
+
+    std::vector<Individual> m_trials;            /**< Trial vectors, one per individual */
+    std::vector<Random>     m_individual_random; /**< Random stream of each individual */
+    std::vector<double>     m_crossover;         /**< Crossover random numbers, d per individual */
+    std::vector<double>     m_f;                 /**< Scale factor of each trial */
+    std::vector<double>     m_cr;                /**< Crossover rate of each trial */
+    std::size_t             m_n_trials;          /**< Number of trials evaluated in the last generation */
+    std::vector<Point>      m_archive;           /**< Archive of the replaced parents, allocated once */
+    std::size_t             m_n_archive;         /**< Number of parents in the archive */
+    std::size_t             m_n_pbest;           /**< Number of individuals among which x_pbest is drawn */
+    std::size_t             m_initial_size;      /**< Initial size of the population */
+    std::vector<double>     m_memory_f;          /**< Memory of the means of the successful F */
+    std::vector<double>     m_memory_cr;         /**< Memory of the means of the successful CR */
+    std::size_t             m_memory_pos;        /**< Entry of the memory updated next */
+    std::vector<double>     m_success_f;         /**< F of the trials better than their parent */
+    std::vector<double>     m_success_cr;        /**< CR of the trials better than their parent */
+    std::vector<double>     m_success_weight;    /**< Improvement of the cost of the successful trials */
+  };
+
+}
+#endif
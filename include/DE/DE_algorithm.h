@@ -0,0 +1,43 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_DE_algorithm_h
+#define EmiROOT_DE_algorithm_h
+
+#include <Base/AlgorithmBase.h>
+#include "DEConfig.h"
+#include "DEPopulation.h"
+
+namespace EmiROOT {
+
+  class DE_algorithm : public AlgorithmBase<DE_algorithm, DEPopulation, DEConfig> {
+  public:
+    DE_algorithm(const Function&, const DEConfig&);
+
+  private:
+    friend class AlgorithmBase<DE_algorithm, DEPopulation, DEConfig>;
+
+    /// Advance the population by one generation
+    void step();
+  };
+
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<DE_algorithm, DEPopulation, DEConfig>;
+
+}
+#endif
@@ -30,17 +30,6 @@ namespace EmiROOT {
 
     /// Chromosome default constructor
     GAChromosome(int n);
-
-    /// Set the value of the indicator equal to 1;
-    void setIndicatorUp();
-
-    /// Set the value of the indicator equal to 0
-    void setIndicatorDown();
-
-    double getIndicator() const;
-
-  private:
-    int  m_indicator; /**< When 0 the cost needs to be revaluated */
   };
 
 }
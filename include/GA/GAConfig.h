@@ -20,6 +20,7 @@
 #define EmiROOT_GAConfig_h
 
 #include <Base/Config.h>
+#include <Base/Selection.h>
 #include <string>
 
 namespace EmiROOT {
@@ -36,7 +37,7 @@ namespace EmiROOT {
     /// Set the selection rate
     void setKeepFraction(double);
 
-    /// Set the values for m_keep and m_prob
+    /// Set m_keep and the roulette wheel used to select the parents
     void setConfigCrossover();
 
     /// Return the mutation rate
@@ -48,16 +49,19 @@ namespace EmiROOT {
     /// Return m_keep
     int getKeep() const;
 
-    /// Return m_prob
+    /// Return the cumulative probability of selecting one of the first t+1 chromosomes
     double getProb(int) const;
 
+    /// Return the roulette wheel used to select the parents
+    const RouletteWheel& getRouletteWheel() const;
+
   private:
 
     double m_keep_fraction;     /**< Selection rate */
     double m_mutation_rate;     /**< Mutation rate */
 
-    int                 m_keep; /**< Number of chromosomes that survives to selection */
-    std::vector<double> m_prob; /**< Vector of probabilities used in the Roulette Wheel selection */
+    int           m_keep;     /**< Number of chromosomes that survives to selection */
+    RouletteWheel m_roulette; /**< Rank-based roulette wheel used to select the parents */
   };
 
 }
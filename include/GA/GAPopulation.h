@@ -21,11 +21,11 @@
 
 #include "GAChromosome.h"
 #include "GAConfig.h"
-#include <Base/Population.h>
+#include <Base/PopulationBase.h>
 
 namespace EmiROOT {
 
-  class GAPopulation : public Population {
+  class GAPopulation : public PopulationBase<GAPopulation, GAChromosome, GAConfig> {
   public:
 
     //// Common methods ///////////////////////////////////////
@@ -33,36 +33,15 @@ namespace EmiROOT {
 
     void init();
 
-    void setConfig(const GAConfig&);
-
-    /// Access the specified chromosome
-    GAChromosome &operator[](std::size_t t) { return m_individuals[t]; };
-
-    /// Return the position of all chromosomes
-    std::vector<std::vector<double> > getPopulationPosition();
-
-    /// Return the size of the population
-    std::size_t getSize() {return m_individuals.size();};
-
-    /// Return the best chromosome
-    GAChromosome* getBestSolution();
-
-    void evaluate();
-
-    void evaluate(GAChromosome&);
     ///////////////////////////////////////////////////////////
 
-    //// Specific methods /////////////////////////////////////
-    void sort();
+    /// Rank the chromosomes by cost. Only the ones kept for mating are
+    /// sorted, the chromosomes themselves are not moved.
+    void rank();
 
     void crossover();
 
     void mutation();
-
-  private:
-    GAConfig                  m_config;
-    std::vector<GAChromosome> m_individuals;
-    GAChromosome              m_best_solution;
   };
 
 }
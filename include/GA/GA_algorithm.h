@@ -19,25 +19,28 @@
 #ifndef EmiROOT_GA_algorithm_h
 #define EmiROOT_GA_algorithm_h
 
-#include <Base/Algorithm.h>
+#include <Base/AlgorithmBase.h>
 #include "GAConfig.h"
 #include "GAPopulation.h"
 
 namespace EmiROOT {
 
-  class GA_algorithm : public Algorithm {
+  class GA_algorithm : public AlgorithmBase<GA_algorithm, GAPopulation, GAConfig> {
   public:
     GA_algorithm(const Function&, const GAConfig&);
 
-    void setSeed(uint64_t);
-
-    void minimize();
-
   private:
+    friend class AlgorithmBase<GA_algorithm, GAPopulation, GAConfig>;
 
-    GAConfig m_algo_config;
-    GAPopulation m_population;
+    /// Evaluate the initial population
+    void initialize();
+
+    /// Advance the population by one iteration
+    void step();
   };
 
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<GA_algorithm, GAPopulation, GAConfig>;
+
 }
 #endif
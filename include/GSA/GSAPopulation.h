@@ -21,30 +21,20 @@
 
 #include "Planet.h"
 #include "GSAConfig.h"
-#include <Base/Population.h>
+#include <Base/PopulationBase.h>
 
 namespace EmiROOT {
 
-  class GSAPopulation : public Population {
+  class GSAPopulation : public PopulationBase<GSAPopulation, Planet, GSAConfig> {
   public:
 
     GSAPopulation(Function);
 
     void init();
 
-    void setConfig(const GSAConfig&);
-
-    /// Access the specified planet
-    Planet &operator[](std::size_t t) { return m_individuals[t]; };
-
-    /// Return the position of all planets
-    std::vector<std::vector<double> > getPopulationPosition();
-
-    /// Return the size of the population
-    std::size_t getSize() {return m_individuals.size();};
-
-    /// Return the best planet
-    Planet* getBestSolution();
+    /// Select the Kbest planets attracting the others at the given
+    /// iteration; they are not sorted and the planets are not moved
+    void rank(std::size_t);
 
     void setMass();
 
@@ -52,16 +42,9 @@ namespace EmiROOT {
 
     void move(std::size_t);
 
-    void evaluate();
-
-    void evaluate(Planet&);
-
-    void sort();
-
   private:
-    GSAConfig           m_config;
-    std::vector<Planet> m_individuals;
-    Planet              m_best_solution;
+    std::vector<std::vector<double> > m_distance; /**< Distances between the planets */
+    std::size_t                       m_n_best;   /**< Number of attracting planets, the first ranks of m_order */
   };
 
 }
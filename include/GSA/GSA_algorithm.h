@@ -19,25 +19,25 @@
 #ifndef EmiROOT_GSA_algorithm_h
 #define EmiROOT_GSA_algorithm_h
 
-#include <Base/Algorithm.h>
+#include <Base/AlgorithmBase.h>
 #include "GSAConfig.h"
 #include "GSAPopulation.h"
 
 namespace EmiROOT {
 
-  class GSA_algorithm : public Algorithm {
+  class GSA_algorithm : public AlgorithmBase<GSA_algorithm, GSAPopulation, GSAConfig> {
   public:
     GSA_algorithm(const Function&, const GSAConfig&);
 
-    void setSeed(uint64_t);
-
-    void minimize();
-
   private:
+    friend class AlgorithmBase<GSA_algorithm, GSAPopulation, GSAConfig>;
 
-    GSAConfig m_algo_config;
-    GSAPopulation m_population;
+    /// Advance the population by one iteration
+    void step();
   };
 
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<GSA_algorithm, GSAPopulation, GSAConfig>;
+
 }
 #endif
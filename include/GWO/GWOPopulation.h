@@ -21,11 +21,11 @@
 
 #include "Wolf.h"
 #include "GWOConfig.h"
-#include <Base/Population.h>
+#include <Base/PopulationBase.h>
 
 namespace EmiROOT {
 
-  class GWOPopulation : public Population {
+  class GWOPopulation : public PopulationBase<GWOPopulation, Wolf, GWOConfig> {
   public:
 
     //// Common methods ///////////////////////////////////////
@@ -33,23 +33,6 @@ namespace EmiROOT {
 
     void init();
 
-    void setConfig(const GWOConfig&);
-
-    /// Access the specified wolf
-    Wolf &operator[](std::size_t t) { return m_individuals[t]; };
-
-    /// Return the position of all wolves
-    std::vector<std::vector<double> > getPopulationPosition();
-
-    /// Return the size of the population
-    std::size_t getSize() {return m_individuals.size();};
-
-    /// Return the best wolf
-    Wolf* getBestSolution();
-
-    void evaluate();
-
-    void evaluate(Wolf&);
     ///////////////////////////////////////////////////////////
 
     //// Specific methods /////////////////////////////////////
@@ -57,15 +40,19 @@ namespace EmiROOT {
 
     void moveWolves();
 
+  protected:
+    friend class PopulationBase<GWOPopulation, Wolf, GWOConfig>;
+
+    /// Keep track of the alpha, beta and delta wolves and of the best solution
+    void track(Wolf&);
+
   private:
 
-    GWOConfig         m_config;    /**< Configuration */
-    Wolf              m_alpha;
-    Wolf              m_beta;
-    Wolf              m_delta;
-    std::vector<Wolf> m_individuals;    /**< Wolves in the population */
-    double            m_a;
-    Wolf              m_best_solution;
+    Wolf                m_alpha;
+    Wolf                m_beta;
+    Wolf                m_delta;
+    double              m_a;
+    std::vector<double> m_random_numbers; /**< Random numbers of the move of a wolf, allocated once */
   };
 
 }
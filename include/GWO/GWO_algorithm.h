@@ -19,25 +19,25 @@
 #ifndef EmiROOT_GWO_algorithm_h
 #define EmiROOT_GWO_algorithm_h
 
-#include <Base/Algorithm.h>
+#include <Base/AlgorithmBase.h>
 #include "GWOConfig.h"
 #include "GWOPopulation.h"
 
 namespace EmiROOT {
 
-  class GWO_algorithm : public Algorithm {
+  class GWO_algorithm : public AlgorithmBase<GWO_algorithm, GWOPopulation, GWOConfig> {
   public:
     GWO_algorithm(const Function&, const GWOConfig&);
 
-    void setSeed(uint64_t);
-
-    void minimize();
-
   private:
+    friend class AlgorithmBase<GWO_algorithm, GWOPopulation, GWOConfig>;
 
-    GWOConfig m_algo_config;
-    GWOPopulation m_population;
+    /// Advance the population by one iteration
+    void step();
   };
 
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<GWO_algorithm, GWOPopulation, GWOConfig>;
+
 }
 #endif
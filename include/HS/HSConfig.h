@@ -34,16 +34,23 @@ namespace EmiROOT {
 
     void setBw(double);
 
+    /// Set the number of harmonies improvised at each iteration (default 1).
+    /// They are improvised from the same memory and evaluated together.
+    void setNNewHarmonies(std::size_t);
+
     double getHmcr() const;
 
     double getPar() const;
 
     double getBw() const;
 
+    std::size_t getNNewHarmonies() const;
+
   private:
     double m_hmcr;            /**< Harmony memory considering rate */
     double m_par;             /**< Pitch adjusting rate */
     double m_bw;              /**< Distance bandwidth */
+    std::size_t m_n_new;      /**< Number of harmonies improvised at each iteration */
   };
 
 }
@@ -21,11 +21,11 @@
 
 #include <Base/Individual.h>
 #include "HSConfig.h"
-#include <Base/Population.h>
+#include <Base/PopulationBase.h>
 
 namespace EmiROOT {
 
-  class HSPopulation : public Population {
+  class HSPopulation : public PopulationBase<HSPopulation, Individual, HSConfig> {
   public:
 
     //// Common methods ///////////////////////////////////////
@@ -33,34 +33,23 @@ namespace EmiROOT {
 
     void init();
 
-    void setConfig(const HSConfig&);
-
-    /// Access the specified individual
-    Individual &operator[](std::size_t t) { return m_individuals[t]; };
-
-    /// Return the position of all individuals
-    std::vector<std::vector<double> > getPopulationPosition();
-
-    /// Return the size of the population
-    std::size_t getSize() {return m_individuals.size();};
-
-    /// Return the best individual
-    Individual* getBestSolution();
-
-    void evaluate();
-
-    void evaluate(Individual&);
     ///////////////////////////////////////////////////////////
 
     //// Specific methods /////////////////////////////////////
-    void generateNewHarmony();
+    /// Order the harmony memory by cost
+    void sortMemory();
+
+    /// Scale the penalty coefficient and order the memory again, since
+    /// the cost of the infeasible harmonies changed
+    double scalePenaltyCoeff();
 
-    void sort();
+    /// Improvise the new harmonies of an iteration. Each of them that is
+    /// better than the worst harmony in the memory replaces it.
+    void generateNewHarmonies();
 
   private:
-    HSConfig                m_config;
-    std::vector<Individual> m_individuals;
-    Individual              m_best_solution; /**< Best harmony */
+    std::vector<Individual> m_new_harmonies; /**< Candidate harmonies, allocated once */
+    Ordering                m_memory;        /**< Order of the harmonies by cost */
   };
 
 }
@@ -19,25 +19,28 @@
 #ifndef EmiROOT_HS_algorithm_h
 #define EmiROOT_HS_algorithm_h
 
-#include <Base/Algorithm.h>
+#include <Base/AlgorithmBase.h>
 #include "HSConfig.h"
 #include "HSPopulation.h"
 
 namespace EmiROOT {
 
-  class HS_algorithm : public Algorithm {
+  class HS_algorithm : public AlgorithmBase<HS_algorithm, HSPopulation, HSConfig> {
   public:
     HS_algorithm(const Function&, const HSConfig&);
 
-    void setSeed(uint64_t);
-
-    void minimize();
-
   private:
+    friend class AlgorithmBase<HS_algorithm, HSPopulation, HSConfig>;
 
-    HSConfig m_algo_config;
-    HSPopulation m_population;
+    /// Evaluate the initial population
+    void initialize();
+
+    /// Advance the population by one iteration
+    void step();
   };
 
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<HS_algorithm, HSPopulation, HSConfig>;
+
 }
 #endif
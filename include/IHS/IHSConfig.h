@@ -38,6 +38,10 @@ namespace EmiROOT {
 
     void setBwMax(double);
 
+    /// Set the number of harmonies improvised at each iteration (default 1).
+    /// They are improvised from the same memory and evaluated together.
+    void setNNewHarmonies(std::size_t);
+
     double getHmcr() const;
 
     double getParMin() const;
@@ -48,12 +52,15 @@ namespace EmiROOT {
 
     double getBwMax() const;
 
+    std::size_t getNNewHarmonies() const;
+
   private:
-    double m_hmcr;    /**< Harmony memory considering rate */
-    double m_par_min; /**< Minimum pitch adjusting rate */
-    double m_par_max; /**< Maximum pitch adjusting rate */
-    double m_bw_min;  /**< Minumum distance bandwidth */
-    double m_bw_max;  /**< Maximum distance bandwidth */
+    double      m_hmcr;    /**< Harmony memory considering rate */
+    double      m_par_min; /**< Minimum pitch adjusting rate */
+    double      m_par_max; /**< Maximum pitch adjusting rate */
+    double      m_bw_min;  /**< Minumum distance bandwidth */
+    double      m_bw_max;  /**< Maximum distance bandwidth */
+    std::size_t m_n_new;   /**< Number of harmonies improvised at each iteration */
   };
 
 }
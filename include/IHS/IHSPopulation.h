@@ -21,11 +21,11 @@
 
 #include <Base/Individual.h>
 #include "IHSConfig.h"
-#include <Base/Population.h>
+#include <Base/PopulationBase.h>
 
 namespace EmiROOT {
 
-  class IHSPopulation : public Population {
+  class IHSPopulation : public PopulationBase<IHSPopulation, Individual, IHSConfig> {
   public:
 
     //// Common methods ///////////////////////////////////////
@@ -33,38 +33,27 @@ namespace EmiROOT {
 
     void init();
 
-    void setConfig(const IHSConfig&);
-
-    /// Access the specified individual
-    Individual &operator[](std::size_t t) { return m_individuals[t]; };
-
-    /// Return the position of all individuals
-    std::vector<std::vector<double> > getPopulationPosition();
-
-    /// Return the size of the population
-    std::size_t getSize() {return m_individuals.size();};
-
-    /// Return the best individual
-    Individual* getBestSolution();
-
-    void evaluate();
-
-    void evaluate(Individual&);
     ///////////////////////////////////////////////////////////
 
     //// Specific methods /////////////////////////////////////
     void updateParameters(std::size_t);
 
-    void generateNewHarmony();
+    /// Order the harmony memory by cost
+    void sortMemory();
+
+    /// Scale the penalty coefficient and order the memory again, since
+    /// the cost of the infeasible harmonies changed
+    double scalePenaltyCoeff();
 
-    void sort();
+    /// Improvise the new harmonies of an iteration. Each of them that is
+    /// better than the worst harmony in the memory replaces it.
+    void generateNewHarmonies();
 
   private:
-    IHSConfig                m_config;
-    std::vector<Individual>  m_individuals;
+    std::vector<Individual>  m_new_harmonies; /**< Candidate harmonies, allocated once */
+    Ordering                 m_memory;        /**< Order of the harmonies by cost */
     double                   m_current_par;
     double                   m_current_bw;
-    Individual               m_best_solution; /**< Best harmony */
   };
 
 }
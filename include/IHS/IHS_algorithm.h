@@ -19,25 +19,28 @@
 #ifndef EmiROOT_IHS_algorithm_h
 #define EmiROOT_IHS_algorithm_h
 
-#include <Base/Algorithm.h>
+#include <Base/AlgorithmBase.h>
 #include "IHSConfig.h"
 #include "IHSPopulation.h"
 
 namespace EmiROOT {
 
-  class IHS_algorithm : public Algorithm {
+  class IHS_algorithm : public AlgorithmBase<IHS_algorithm, IHSPopulation, IHSConfig> {
   public:
     IHS_algorithm(const Function&, const IHSConfig&);
 
-    void setSeed(uint64_t);
-
-    void minimize();
-
   private:
+    friend class AlgorithmBase<IHS_algorithm, IHSPopulation, IHSConfig>;
 
-    IHSConfig m_algo_config;
-    IHSPopulation m_population;
+    /// Evaluate the initial population
+    void initialize();
+
+    /// Advance the population by one iteration
+    void step();
   };
 
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<IHS_algorithm, IHSPopulation, IHSConfig>;
+
 }
 #endif
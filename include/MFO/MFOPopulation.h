@@ -21,11 +21,11 @@
 
 #include "Moth.h"
 #include "MFOConfig.h"
-#include <Base/Population.h>
+#include <Base/PopulationBase.h>
 
 namespace EmiROOT {
 
-  class MFOPopulation : public Population {
+  class MFOPopulation : public PopulationBase<MFOPopulation, Moth, MFOConfig> {
   public:
 
     //// Common methods ///////////////////////////////////////
@@ -33,23 +33,6 @@ namespace EmiROOT {
 
     void init();
 
-    void setConfig(const MFOConfig&);
-
-    /// Access the specified moth
-    Moth &operator[](std::size_t t) { return m_individuals[t]; };
-
-    /// Return the position of all moths
-    std::vector<std::vector<double> > getPopulationPosition();
-
-    /// Return the size of the population
-    std::size_t getSize() {return m_individuals.size();};
-
-    /// Return the best moth
-    Moth* getBestSolution();
-
-    void evaluate();
-
-    void evaluate(Moth&);
     ///////////////////////////////////////////////////////////
 
     //// Specific methods /////////////////////////////////////
@@ -59,16 +42,24 @@ namespace EmiROOT {
 
     void updateParameters(std::size_t);
 
+    /// Move the moths around the flames and evaluate them
     void moveMoths();
 
+    /// Replace the flames with the best among the flames and the moths
+    void updateFlames();
+
+    /// Scale the penalty coefficient, updating the cost of the flames too,
+    /// which are sorted again
+    double scalePenaltyCoeff();
+
   private:
 
-    MFOConfig          m_config;       /**< Configuration */
-    std::vector<Moth>  m_individuals;  /**< Moths in the population */
-    std::vector<Moth>  m_flames;       /**< Moths in the population */
-    Moth               m_best_solution;
-    double             m_a;
-    std::size_t        m_n_flame;
+    std::vector<Moth>   m_flames;      /**< Best positions found so far, sorted by cost */
+    std::vector<Moth>   m_merged;      /**< New flames, merged from the flames and the moths */
+    std::vector<Random> m_moth_random; /**< Random stream of each moth */
+    std::vector<double> m_spiral;      /**< Spiral parameter of each coordinate of each moth, allocated once */
+    double              m_a;
+    std::size_t         m_n_flame;
   };
 
 }
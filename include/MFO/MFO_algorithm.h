@@ -19,25 +19,28 @@
 #ifndef EmiROOT_MFO_algorithm_h
 #define EmiROOT_MFO_algorithm_h
 
-#include <Base/Algorithm.h>
+#include <Base/AlgorithmBase.h>
 #include "MFOConfig.h"
 #include "MFOPopulation.h"
 
 namespace EmiROOT {
 
-  class MFO_algorithm : public Algorithm {
+  class MFO_algorithm : public AlgorithmBase<MFO_algorithm, MFOPopulation, MFOConfig> {
   public:
     MFO_algorithm(const Function&, const MFOConfig&);
 
-    void setSeed(uint64_t);
-
-    void minimize();
-
   private:
+    friend class AlgorithmBase<MFO_algorithm, MFOPopulation, MFOConfig>;
 
-    MFOConfig m_algo_config;
-    MFOPopulation m_population;
+    /// Evaluate the initial population
+    void initialize();
+
+    /// Advance the population by one iteration
+    void step();
   };
 
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<MFO_algorithm, MFOPopulation, MFOConfig>;
+
 }
 #endif
@@ -23,6 +23,14 @@
 
 namespace EmiROOT {
 
+  /// Topology of the swarm, that is the particles informing each particle:
+  /// - GBEST      : the whole swarm, so every particle follows the best solution
+  /// - RING       : the particle and its two neighbours on a ring
+  /// - VON_NEUMANN: the particle and its four neighbours on a toroidal grid
+  /// - RANDOM_K   : the particle and k random particles, drawn again after
+  ///                each iteration that did not improve the best solution
+  enum PSTopology {GBEST, RING, VON_NEUMANN, RANDOM_K};
+
   class PSConfig : public Config {
   public:
 
@@ -40,6 +48,12 @@ namespace EmiROOT {
 
     void setInertia(double);
 
+    /// Set the topology of the swarm (GBEST by default)
+    void setTopology(PSTopology);
+
+    /// Set the number of random informants of the RANDOM_K topology (3 by default)
+    void setNInformants(std::size_t);
+
     const std::vector<double>& getAlpha() const;
 
     double getAlphaEvolution() const;
@@ -51,6 +65,10 @@ namespace EmiROOT {
 
     double getInertia() const;
 
+    PSTopology getTopology() const;
+
+    std::size_t getNInformants() const;
+
   private:
 
     std::vector<double> m_alpha;                /**< Maximum velocity in % of the range of parameters */
@@ -58,6 +76,8 @@ namespace EmiROOT {
     double              m_social;               /**< Social parameter */
     double              m_cognitive;            /**< Cognitive parameter */
     double              m_inertia;              /**< Inertia factor */
+    PSTopology          m_topology;             /**< Topology of the swarm */
+    std::size_t         m_n_informants;         /**< Number of random informants of the RANDOM_K topology */
   };
 
 }
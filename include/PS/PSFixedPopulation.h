@@ -0,0 +1,322 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_PSFixedPopulation_h
+#define EmiROOT_PSFixedPopulation_h
+
+#include "PSParticle.h"
+#include "PSConfig.h"
+#include "PSNeighbourhood.h"
+#include <Base/Kernels.h>
+#include <Base/Population.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace EmiROOT {
+
+  /// Particle swarm population for a D-dimensional problem, with D known at
+  /// compile time. Positions and velocities are stored in std::array, the
+  /// loops on the dimensions have a constant trip count and the boundaries
+  /// are cached at initialization, so the move does not touch the heap nor
+  /// the SearchSpace. The update rules, the topologies, the random streams
+  /// of the particles, the boundary conditions and the bookkeeping of the
+  /// best solutions are the same as in PSPopulation.
+  template<std::size_t D>
+  class PSFixedPopulation : public Population {
+  public:
+    typedef std::array<double, D> FixedPoint;
+
+    PSFixedPopulation(Function t) : Population(t) {}
+
+    void setConfig(const PSConfig& t) {m_config = t;}
+
+    PSConfig& getConfig() {return m_config;}
+
+    void init();
+
+    /// Return the position of all particles
+    std::vector<std::vector<double> > getPopulationPosition();
+
+    /// Return the size of the population
+    std::size_t getSize() {return m_particles.size();}
+
+    /// Return a copy of the specified particle, refreshed at each call
+    PSParticle* getIndividual(std::size_t);
+
+    /// Return the best particle
+    PSParticle* getBestSolution() {return &m_best_solution;}
+
+    /// Evaluate the cost of all the particles, within the budget of evaluations
+    void evaluate();
+
+    void setVelocity(std::size_t);
+
+    void moveParticles(std::size_t);
+
+  private:
+    struct Particle {
+      FixedPoint position;
+      FixedPoint velocity;
+      FixedPoint best_position;
+      double     cost;
+      double     best_cost;
+    };
+
+    void evaluate(Particle&);
+
+    void checkBoundary(Particle&, Random&);
+
+    PSConfig                m_config;
+    std::vector<Particle>   m_particles;
+    std::vector<Random>     m_particle_random; /**< Random stream of each particle */
+    PSNeighbourhood         m_neighbourhood;
+    std::vector<PSParticle> m_view;          /**< Particles exposed through getIndividual */
+    PSParticle              m_best_solution;
+    FixedPoint              m_best_position;
+    FixedPoint              m_min;
+    FixedPoint              m_max;
+    FixedPoint              m_alpha;         /**< Maximum velocity, as a fraction of the range */
+    Point                   m_point;         /**< Buffer passed to the cost function */
+  };
+  //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+  template<std::size_t D>
+  void PSFixedPopulation<D>::init() {
+    std::size_t pop_size = m_config.getPopulationSize();
+    std::vector<double> alpha = m_config.getAlpha();
+
+    if (m_search_space.getNumberOfParameters() != D) {
+      std::cout << "The number of parameters (" << m_search_space.getNumberOfParameters()
+                << ") does not match the dimension of PSFixedPopulation (" << D << ").\n";
+      abort();
+    }
+
+    // check on the size of alpha_vel
+    if (alpha.size() == 1 && alpha.size() < D) {
+      alpha.assign(D, alpha[0]);
+      m_config.setAlpha(alpha);
+    } else if (alpha.size() != D) {
+      std::cout << "Wrong size for parameter alpha_vel.\n";
+      abort();
+    }
+
+    for (std::size_t j = 0; j < D; ++j) {
+      m_min[j]   = m_search_space[j].getMin();
+      m_max[j]   = m_search_space[j].getMax();
+      m_alpha[j] = alpha[j];
+    }
+
+    Particle empty;
+    empty.position.fill(0.);
+    empty.velocity.fill(0.);
+    empty.best_position.fill(0.);
+    empty.cost      = std::numeric_limits<double>::max();
+    empty.best_cost = std::numeric_limits<double>::max();
+    m_particles.assign(pop_size, empty);
+
+    // Load the positions provided by the user, at most one per particle
+    std::size_t n_loaded = std::min((std::size_t) m_initial_population.size(), pop_size);
+    for (std::size_t i = 0; i < n_loaded; ++i) {
+      std::copy_n(m_initial_population[i].begin(), D, m_particles[i].position.begin());
+    }
+    m_search_space.startInitialDesign(pop_size - n_loaded);
+
+    if (n_loaded < pop_size) {
+
+      // Generate randomly the position of the other particles
+      if (!m_silent) std::cout << "Generating the initial population...\n";
+      for (std::size_t i = n_loaded; i < pop_size; ++i) {
+        Particle& p = m_particles[i];
+        const Point& x = m_search_space.getRandom();
+        std::copy_n(x.begin(), D, p.position.begin());
+        for (std::size_t j = 0; j < D; ++j) {
+          double delta = m_max[j] - m_min[j];
+          p.velocity[j] = m_random.rand(-delta*m_alpha[j], delta*m_alpha[j]);
+        }
+      }
+    }
+
+    // Random stream of each particle and informants of the particles
+    m_particle_random.clear();
+    for (std::size_t i = 0; i < pop_size; ++i) m_particle_random.push_back(m_random.split());
+    m_neighbourhood.init(pop_size, m_config, m_random);
+
+    m_view.assign(pop_size, PSParticle(D));
+    m_point.assign(D, 0.);
+
+    // Dummy assignment of the best particle. When the cost of
+    // the population is actually evaluated this is fixed.
+    m_best_position = m_particles[0].position;
+    m_best_solution = PSParticle(D);
+    std::copy(m_best_position.begin(), m_best_position.end(), m_best_solution.getPosition().begin());
+  }
+  //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+  template<std::size_t D>
+  std::vector<std::vector<double> > PSFixedPopulation<D>::getPopulationPosition() {
+    std::vector<std::vector<double> > positions(m_particles.size());
+    for (std::size_t i = 0; i < m_particles.size(); ++i) {
+      positions[i].assign(m_particles[i].position.begin(), m_particles[i].position.end());
+    }
+    return positions;
+  }
+  //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+  template<std::size_t D>
+  PSParticle* PSFixedPopulation<D>::getIndividual(std::size_t t) {
+    const Particle& p = m_particles[t];
+    std::copy(p.position.begin(), p.position.end(), m_view[t].getPosition().begin());
+    for (std::size_t j = 0; j < D; ++j) m_view[t].setVelocity(j, p.velocity[j]);
+    m_view[t].setCost(p.cost);
+    return &m_view[t];
+  }
+  //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+  template<std::size_t D>
+  void PSFixedPopulation<D>::evaluate() {
+    for (Particle& p : m_particles) {
+      if (isBudgetExhausted()) break;
+      evaluate(p);
+    }
+  }
+  //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+  template<std::size_t D>
+  void PSFixedPopulation<D>::evaluate(Particle& p) {
+    // The cost function may round the integer parameters or
+    // regenerate the point, so the position is copied back
+    std::copy(p.position.begin(), p.position.end(), m_point.begin());
+    p.cost = evaluateCost(m_point);
+    std::copy(m_point.begin(), m_point.end(), p.position.begin());
+
+    if (ckeckViolateConstraints(m_point) == false) {
+
+      // Update personal best solution
+      if (p.cost < p.best_cost) {
+        p.best_cost     = p.cost;
+        p.best_position = p.position;
+      }
+
+      // Update the global best solution
+      if (p.cost < m_best_solution.getCost()) {
+        m_best_position = p.position;
+        m_best_solution.setPosition(m_point);
+        m_best_solution.setCost(p.cost);
+      }
+
+    }
+  }
+  //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+  template<std::size_t D>
+  void PSFixedPopulation<D>::setVelocity(std::size_t iter) {
+    double h = m_config.getAlphaEvolution();
+    double iter_max = m_config.getNMaxIterations();
+    double cognitive_par = m_config.getCognitiveParameter();
+    double social_par = m_config.getSocialParameter();
+    double inertia = m_config.getInertia() * (1.0 - 0.5 * (iter/iter_max));
+    double k = std::pow(1.0 - (iter/iter_max), h);
+
+    // maximum velocity, shrinking with the iterations
+    FixedPoint max_vel;
+    for (std::size_t j = 0; j < D; ++j) max_vel[j] = m_alpha[j] * k * (m_max[j] - m_min[j]);
+
+    if (!m_neighbourhood.isGlobal()) {
+      m_neighbourhood.update(m_best_solution.getCost(), m_random);
+      m_neighbourhood.findBest([this](std::size_t t) {return m_particles[t].best_cost;});
+    }
+
+    // The random numbers are drawn from the stream of each particle and the
+    // velocity is computed by the same kernel as in PSPopulation, so that
+    // the two populations follow the same trajectory
+    std::array<double, 2*D> r;
+    for (std::size_t i = 0; i < m_particles.size(); ++i) {
+      Particle& p = m_particles[i];
+      m_particle_random[i].fill(r.data(), 2*D);
+      const FixedPoint& guide = m_neighbourhood.isGlobal() ? m_best_position : m_particles[m_neighbourhood[i]].best_position;
+      Kernels::velocity(p.velocity.data(), p.position.data(), p.best_position.data(), guide.data(), r.data(),
+                        inertia, cognitive_par, social_par, max_vel.data(), D);
+    }
+  }
+  //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+  template<std::size_t D>
+  void PSFixedPopulation<D>::moveParticles(std::size_t iter) {
+    // Change the velocity of the particles
+    setVelocity(iter);
+
+    for (std::size_t i = 0; i < m_particles.size(); ++i) {
+      Particle& p = m_particles[i];
+      for (std::size_t j = 0; j < D; ++j) p.position[j] += p.velocity[j];
+
+      // boundary check
+      checkBoundary(p, m_particle_random[i]);
+    }
+  }
+  //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+  template<std::size_t D>
+  void PSFixedPopulation<D>::checkBoundary(Particle& p, Random& random) {
+    EMIROOT_PROFILE(m_profiler, BOUNDARY);
+
+    if (m_constraints.size() > 0 && m_oob_sol == DIS) { // Disregard the out-of-bound solution and generate a new one (DIS)
+      const Point& x = m_search_space.getRandom();
+      std::copy_n(x.begin(), D, p.position.begin());
+      return;
+    }
+
+    for (std::size_t j = 0; j < D; ++j) {
+      double& x = p.position[j];
+
+      if (m_oob_sol == PBC) { // Periodic Boundary Condition (PBC)
+
+        if (x < m_min[j]) x = m_max[j] - fabs(x - m_min[j]);
+        if (x > m_max[j]) x = m_min[j] + fabs(m_max[j] - x);
+        if (x < m_min[j] || x > m_max[j]) x = random.rand(m_min[j], m_max[j]);
+
+      } else if (m_oob_sol == BAB) { // Place out-of-bound solutions back at the boundaries (BAB)
+
+        x = std::min(std::max(x, m_min[j]), m_max[j]);
+
+      } else if (m_oob_sol == DIS) { // Disregard the out-of-bound solution and generate a new one (DIS)
+
+        if (x < m_min[j] || x > m_max[j]) x = random.rand(m_min[j], m_max[j]);
+
+      } else if (m_oob_sol == RBC) { // Reflective Boundary Condition (RBC)
+
+        if (x < m_min[j]) x = 2 * m_min[j] - x;
+        if (x > m_max[j]) x = 2 * m_max[j] - x;
+        if (x < m_min[j] || x > m_max[j]) x = random.rand(m_min[j], m_max[j]);
+        p.velocity[j] = -p.velocity[j];
+
+      }
+    }
+  }
+  //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+}
+#endif
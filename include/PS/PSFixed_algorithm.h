@@ -0,0 +1,60 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_PSFixed_algorithm_h
+#define EmiROOT_PSFixed_algorithm_h
+
+#include <Base/AlgorithmBase.h>
+#include "PSConfig.h"
+#include "PSFixedPopulation.h"
+#include <memory>
+
+namespace EmiROOT {
+
+  /// Largest dimension for which makePSAlgorithm uses PSFixed_algorithm
+  constexpr std::size_t PSFixedMaxDimension = 16;
+
+  /// Particle swarm for a problem whose number of parameters D is known at
+  /// compile time. It follows the same trajectory as PS_algorithm for the
+  /// same seed, with a lower overhead on problems with few parameters.
+  template<std::size_t D>
+  class PSFixed_algorithm : public AlgorithmBase<PSFixed_algorithm<D>, PSFixedPopulation<D>, PSConfig> {
+  public:
+    PSFixed_algorithm(const Function& obj_function, const PSConfig& config) :
+    AlgorithmBase<PSFixed_algorithm<D>, PSFixedPopulation<D>, PSConfig>(obj_function, config) {}
+
+  private:
+    friend class AlgorithmBase<PSFixed_algorithm<D>, PSFixedPopulation<D>, PSConfig>;
+
+    /// Advance the population by one iteration
+    void step() {
+      // Move particles
+      this->m_population.moveParticles(this->m_iter - 1);
+
+      // Evaluate the cost for the population
+      this->m_population.evaluate();
+    }
+  };
+
+  /// Create the particle swarm algorithm for a problem with the given number
+  /// of parameters: PSFixed_algorithm up to PSFixedMaxDimension parameters,
+  /// PS_algorithm otherwise.
+  std::unique_ptr<Algorithm> makePSAlgorithm(const Function&, const PSConfig&, std::size_t);
+
+}
+#endif
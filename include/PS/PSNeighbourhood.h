@@ -0,0 +1,83 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#ifndef EmiROOT_PSNeighbourhood_h
+#define EmiROOT_PSNeighbourhood_h
+
+#include "PSConfig.h"
+#include <Base/Random.h>
+#include <limits>
+#include <vector>
+
+namespace EmiROOT {
+
+  /// Informants of each particle of a swarm, according to the topology of
+  /// PSConfig. With a local topology a particle is guided by the best
+  /// personal position among its informants instead of the best solution
+  /// of the whole swarm, so the particles only exchange information with
+  /// their neighbours.
+  class PSNeighbourhood {
+  public:
+    PSNeighbourhood();
+
+    /// Build the informants of a swarm of n particles
+    void init(std::size_t, const PSConfig&, Random&);
+
+    /// Return true if every particle is guided by the best solution
+    bool isGlobal() const {return m_topology == GBEST;};
+
+    /// Update the informants at the end of an iteration, given the cost of
+    /// the best solution: the random informants are drawn again if the
+    /// best solution did not improve
+    void update(double, Random&);
+
+    /// Find the best informant of each particle, given a function
+    /// returning the cost of the best personal position of a particle
+    template<typename F>
+    void findBest(F cost) {
+      for (std::size_t i = 0; i < m_best.size(); ++i) {
+        const std::size_t* informants = &m_informants[i*m_size];
+        std::size_t best = informants[0];
+        double best_cost = cost(best);
+        for (std::size_t k = 1; k < m_size; ++k) {
+          double c = cost(informants[k]);
+          if (c < best_cost) {
+            best_cost = c;
+            best = informants[k];
+          }
+        }
+        m_best[i] = best;
+      }
+    }
+
+    /// Return the best informant of the specified particle
+    std::size_t operator[](std::size_t t) const {return m_best[t];};
+
+  private:
+    void drawInformants(Random&);
+
+    PSTopology               m_topology;
+    std::size_t              m_size;        /**< Number of informants of each particle, itself included */
+    std::size_t              m_n_random;    /**< Number of random informants (RANDOM_K) */
+    std::vector<std::size_t> m_informants;  /**< Informants of each particle, m_size per particle */
+    std::vector<std::size_t> m_best;        /**< Best informant of each particle */
+    double                   m_best_cost;   /**< Cost of the best solution at the last update */
+  };
+
+}
+#endif
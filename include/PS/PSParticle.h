@@ -38,12 +38,17 @@ namespace EmiROOT {
 
     double getVelocity(std::size_t);
 
+    /// Return the velocity, to be updated in place
+    std::vector<double>& getVelocity() {return m_velocity;};
+
     double& getVelocityAddress(std::size_t t) { return m_velocity[t]; };
 
     double getBestPositionParticle(std::size_t);
 
     const std::vector<double>& getBestPositionParticle() const { return m_position_best; };
 
+    double getBestCost() const {return m_cost_best;};
+
     friend bool operator<(const PSParticle &l, const PSParticle &r) { return l.m_cost_best < r.m_cost_best; };
 
   private:
@@ -21,11 +21,12 @@
 
 #include "PSParticle.h"
 #include "PSConfig.h"
-#include <Base/Population.h>
+#include "PSNeighbourhood.h"
+#include <Base/PopulationBase.h>
 
 namespace EmiROOT {
 
-  class PSPopulation : public Population {
+  class PSPopulation : public PopulationBase<PSPopulation, PSParticle, PSConfig> {
   public:
 
     //// Common methods ///////////////////////////////////////
@@ -33,34 +34,33 @@ namespace EmiROOT {
 
     void init();
 
-    void setConfig(const PSConfig&);
-
-    /// Access the specified particle
-    PSParticle &operator[](std::size_t t) { return m_individuals[t]; };
-
-    /// Return the position of all particles
-    std::vector<std::vector<double> > getPopulationPosition();
-
-    /// Return the size of the population
-    std::size_t getSize() {return m_individuals.size();};
-
-    /// Return the best particle
-    PSParticle* getBestSolution();
-
-    void evaluate();
-
-    void evaluate(PSParticle&);
     ///////////////////////////////////////////////////////////
 
     //// Specific methods /////////////////////////////////////
-    void setVelocity(std::size_t);
+    /// Compute the inertia and the maximum velocity of the iteration and
+    /// find the best informant of each particle
+    void updateParameters(std::size_t);
+
+    /// Update the velocity of the specified particle
+    void updateVelocity(std::size_t);
 
+    /// Update the velocity of the particles, move and evaluate them
     void moveParticles(std::size_t);
 
+  protected:
+    friend class PopulationBase<PSPopulation, PSParticle, PSConfig>;
+
+    /// Keep track of the personal best of the particle and of the best solution
+    void track(PSParticle&);
+
   private:
-    PSConfig                m_config;
-    std::vector<PSParticle> m_individuals;
-    PSParticle              m_best_solution;
+    PSNeighbourhood     m_neighbourhood;
+    std::vector<Random> m_particle_random; /**< Random stream of each particle */
+    std::vector<double> m_random_numbers;  /**< Random numbers of the velocity of each particle, allocated once */
+    std::vector<double> m_max_velocity;    /**< Maximum velocity of each parameter at the current iteration */
+    double              m_inertia;
+    double              m_cognitive;
+    double              m_social;
   };
 
 }
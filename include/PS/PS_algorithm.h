@@ -19,25 +19,25 @@
 #ifndef EmiROOT_PS_algorithm_h
 #define EmiROOT_PS_algorithm_h
 
-#include <Base/Algorithm.h>
+#include <Base/AlgorithmBase.h>
 #include "PSConfig.h"
 #include "PSPopulation.h"
 
 namespace EmiROOT {
 
-  class PS_algorithm : public Algorithm {
+  class PS_algorithm : public AlgorithmBase<PS_algorithm, PSPopulation, PSConfig> {
   public:
     PS_algorithm(const Function&, const PSConfig&);
 
-    void setSeed(uint64_t);
-
-    void minimize();
-
   private:
+    friend class AlgorithmBase<PS_algorithm, PSPopulation, PSConfig>;
 
-    PSConfig m_algo_config;
-    PSPopulation m_population;
+    /// Advance the population by one iteration
+    void step();
   };
 
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<PS_algorithm, PSPopulation, PSConfig>;
+
 }
 #endif
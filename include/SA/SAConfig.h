@@ -20,6 +20,7 @@
 #define EmiROOT_SAConfig_h
 
 #include <Base/Config.h>
+#include <Base/Selection.h>
 
 namespace EmiROOT {
 
@@ -43,8 +44,18 @@ namespace EmiROOT {
 
     void setWmin(double t);
 
+    /// Build the rank-based roulette wheel used to select the elite solutions
     void setRouletteWheel();
 
+    /// Enable the replica exchange mode (parallel tempering): each particle
+    /// is a replica at its own temperature, on a geometric ladder starting
+    /// at T0, and the replicas at neighbouring temperatures are swapped
+    void setReplicaExchange(bool);
+
+    /// Set the ratio between the highest and the lowest temperature of the
+    /// ladder in the replica exchange mode (100 by default)
+    void setTemperatureRatio(double);
+
     double getT0() const;
 
     std::size_t getNs() const;
@@ -59,9 +70,16 @@ namespace EmiROOT {
 
     double getWmin() const;
 
-    /// Return m_prob
+    /// Return the cumulative probability of selecting one of the first t+1 particles
     double getProb(int) const;
 
+    /// Return the roulette wheel used to select the elite solutions
+    const RouletteWheel& getRouletteWheel() const;
+
+    bool isReplicaExchange() const;
+
+    double getTemperatureRatio() const;
+
 
   private:
     double              m_T0;    /**< Initial temperature */
@@ -71,7 +89,9 @@ namespace EmiROOT {
     double              m_Rt;   /**< Reduction coefficient for temperature  */
     double              m_Wmax; /**< Maximum value of the weight employed in the formula for the starting point  */
     double              m_Wmin; /**< Minimum value of the weight employed in the formula for the starting point  */
-    std::vector<double> m_Prob; /**< Vector of probabilities used in the Roulette Wheel selection */
+    RouletteWheel       m_roulette; /**< Rank-based roulette wheel used to select the elite solutions */
+    bool                m_replica_exchange;  /**< True to run the replica exchange mode */
+    double              m_temperature_ratio; /**< Ratio between the highest and the lowest temperature of the ladder */
   };
 
 }
@@ -37,13 +37,13 @@ namespace EmiROOT {
 
     const std::vector<double>& getBestPositionParticle() const { return m_position_best; };
 
-    double getBestPositionComponent(std::size_t j);
+    double getBestPositionComponent(std::size_t j) const;
 
     double getBestCostParticle();
 
     void setBest();
 
-    std::vector<std::size_t> getSuccess();
+    const std::vector<std::size_t>& getSuccess() const;
 
     void upSuccess(std::size_t j);
 
@@ -21,11 +21,11 @@
 
 #include "SAParticle.h"
 #include "SAConfig.h"
-#include <Base/Population.h>
+#include <Base/PopulationBase.h>
 
 namespace EmiROOT {
 
-  class SAPopulation : public Population {
+  class SAPopulation : public PopulationBase<SAPopulation, SAParticle, SAConfig> {
   public:
 
     //// Common methods ///////////////////////////////////////
@@ -33,38 +33,48 @@ namespace EmiROOT {
 
     void init();
 
-    void setConfig(const SAConfig&);
-
-    SAConfig& getConfig() {return m_config;}
-
-    /// Access the specified particle
-    SAParticle &operator[](std::size_t t) { return m_individuals[t]; };
-
-    /// Return the position of all particles
-    std::vector<std::vector<double> > getPopulationPosition();
-
-    /// Return the size of the population
-    std::size_t getSize() {return m_individuals.size();};
+    void move();
 
-    /// Return the best particle
-    SAParticle *getBestSolution() {return &m_best_solution;}
+    void setVelocity();
 
-    void evaluate(SAParticle&);
+    /// Rank the particles by cost, without moving them
+    void rank();
 
-    void evaluate();
+    void setStartingPoint(std::size_t);
 
-    void move();
+    /// Replica exchange mode: propose a swap between each pair of replicas
+    /// at neighbouring temperatures, accepted with the Metropolis criterion
+    void exchangeReplicas();
 
-    void setVelocity();
+    /// Replica exchange mode: adapt the spacing of the temperature ladder
+    /// to the acceptance of the swaps since the last call
+    void adaptLadder();
 
-    void setStartingPoint(std::size_t);
+  protected:
+    friend class PopulationBase<SAPopulation, SAParticle, SAConfig>;
 
-    void sort();
+    /// Keep track of the best point of the particle and of the best solution
+    void track(SAParticle&);
 
   private:
-    SAConfig                m_config;
-    std::vector<SAParticle> m_individuals;
-    SAParticle              m_best_solution;
+    /// Move a particle at its temperature through n trials and keep track
+    /// of its best point; the best solution is not updated
+    void sweep(std::size_t, std::size_t);
+
+    /// Compute the temperature of each replica from T0 and the ladder
+    void updateTemperatures();
+
+    std::vector<SAParticle>  m_candidates;      /**< Candidate move of each particle, used with constraints */
+    std::vector<Random>      m_particle_random; /**< Random stream of each particle */
+
+    //// Replica exchange mode ////////////////////////////////
+    std::vector<std::size_t> m_replica;         /**< Replica at each step of the ladder, from the coldest */
+    std::vector<double>      m_temperature;     /**< Temperature of each replica */
+    std::vector<double>      m_log_gap;         /**< Logarithm of the ratio between neighbouring temperatures */
+    std::vector<std::size_t> m_swap_attempts;   /**< Swaps proposed between each pair of neighbouring temperatures */
+    std::vector<std::size_t> m_swap_accepted;   /**< Swaps accepted between each pair of neighbouring temperatures */
+    std::size_t              m_n_exchanges;     /**< Number of rounds of swaps */
+    std::size_t              m_n_adaptations;   /**< Number of adaptations of the ladder */
   };
 
 }
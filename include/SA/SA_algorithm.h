@@ -19,25 +19,28 @@
 #ifndef EmiROOT_SA_algorithm_h
 #define EmiROOT_SA_algorithm_h
 
-#include <Base/Algorithm.h>
+#include <Base/AlgorithmBase.h>
 #include "SAConfig.h"
 #include "SAPopulation.h"
 
 namespace EmiROOT {
 
-  class SA_algorithm : public Algorithm {
+  class SA_algorithm : public AlgorithmBase<SA_algorithm, SAPopulation, SAConfig> {
   public:
     SA_algorithm(const Function&, const SAConfig&);
 
-    void setSeed(uint64_t);
-
-    void minimize();
-
   private:
+    friend class AlgorithmBase<SA_algorithm, SAPopulation, SAConfig>;
 
-    SAConfig m_algo_config;
-    SAPopulation m_population;
+    /// Evaluate the initial population
+    void initialize();
+
+    /// Advance the population by one iteration
+    void step();
   };
 
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<SA_algorithm, SAPopulation, SAConfig>;
+
 }
 #endif
@@ -21,11 +21,11 @@
 
 #include "Whale.h"
 #include "WOAConfig.h"
-#include <Base/Population.h>
+#include <Base/PopulationBase.h>
 
 namespace EmiROOT {
 
-  class WOAPopulation : public Population {
+  class WOAPopulation : public PopulationBase<WOAPopulation, Whale, WOAConfig> {
   public:
 
     //// Common methods ///////////////////////////////////////
@@ -33,23 +33,6 @@ namespace EmiROOT {
 
     void init();
 
-    void setConfig(const WOAConfig&);
-
-    /// Access the specified whale
-    Whale &operator[](std::size_t t) { return m_individuals[t]; };
-
-    /// Return the position of all whales
-    std::vector<std::vector<double> > getPopulationPosition();
-
-    /// Return the size of the population
-    std::size_t getSize() {return m_individuals.size();};
-
-    /// Return the best whale
-    Whale* getBestSolution();
-
-    void evaluate();
-
-    void evaluate(Whale&);
     ///////////////////////////////////////////////////////////
 
     //// Specific methods /////////////////////////////////////
@@ -59,9 +42,6 @@ namespace EmiROOT {
 
   private:
 
-    WOAConfig          m_config;     /**< Configuration */
-    std::vector<Whale> m_individuals;     /**< Whales in the population */
-    Whale              m_best_solution; /**< Best whale */
     double             m_a;
     double             m_a2;
   };
@@ -19,25 +19,25 @@
 #ifndef EmiROOT_WOA_algorithm_h
 #define EmiROOT_WOA_algorithm_h
 
-#include <Base/Algorithm.h>
+#include <Base/AlgorithmBase.h>
 #include "WOAConfig.h"
 #include "WOAPopulation.h"
 
 namespace EmiROOT {
 
-  class WOA_algorithm : public Algorithm {
+  class WOA_algorithm : public AlgorithmBase<WOA_algorithm, WOAPopulation, WOAConfig> {
   public:
     WOA_algorithm(const Function&, const WOAConfig&);
 
-    void setSeed(uint64_t);
-
-    void minimize();
-
   private:
+    friend class AlgorithmBase<WOA_algorithm, WOAPopulation, WOAConfig>;
 
-    WOAConfig m_algo_config;
-    WOAPopulation m_population;
+    /// Advance the population by one iteration
+    void step();
   };
 
+  // The driver is instantiated in the library
+  extern template class AlgorithmBase<WOA_algorithm, WOAPopulation, WOAConfig>;
+
 }
 #endif
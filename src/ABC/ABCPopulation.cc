@@ -20,7 +20,7 @@
 
 using namespace EmiROOT;
 
-ABCPopulation::ABCPopulation(Function func) : Population(func) {}
+ABCPopulation::ABCPopulation(Function func) : PopulationBase(func) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
@@ -33,21 +33,20 @@ void ABCPopulation::init() {
   m_scouters = m_config.getNScoutBees();
   m_onlookers = pop_size - f - m_scouters;
   m_individuals.resize(f, Bee(d));
+  m_candidates.assign(f, Bee(d));
+  m_bee_random.clear();
+  for (std::size_t i = 0; i < f; ++i) m_bee_random.push_back(m_random.split());
   m_prob.resize(f, 0);
   m_trial.resize(f, 0);
 
-  if (m_initial_population.size() > 0) {
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
 
-    // Load the positions provided by the user
-    for (std::size_t i = 0; i < (std::size_t) m_initial_population.size(); ++i) {
-      m_individuals[i].setPosition(m_initial_population[i]);
-    }
-
-  } else {
+  if (n_loaded < m_individuals.size()) {
 
-    // Generate randomly the position of the individuals
+    // Generate randomly the position of the other individuals
     if (!m_silent) std::cout << "Generating the initial population...\n";
-    for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+    for (std::size_t i = n_loaded; i < m_individuals.size(); ++i) {
       m_individuals[i].setPosition(m_search_space.getRandom());
     }
 
@@ -62,75 +61,59 @@ void ABCPopulation::init() {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void ABCPopulation::setConfig(const ABCConfig& t_config) {
-  m_config = t_config;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-std::vector<std::vector<double> > ABCPopulation::getPopulationPosition() {
-  std::vector<std::vector<double> > positions(m_individuals.size());
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) positions[i] = m_individuals[i].getPosition();
-  return positions;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-Bee* ABCPopulation::getBestSolution() {
-  return &m_best_solution;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-std::size_t ABCPopulation::getRandomPopulationIndex(std::size_t i) {
+std::size_t ABCPopulation::getRandomPopulationIndex(std::size_t i, Random& random) {
   std::size_t j = i;
   do {
-    j = m_random.randUInt(0, m_individuals.size()); // [0, m_individuals.size)
+    j = random.randUInt(0, m_individuals.size()); // [0, m_individuals.size)
   } while(j == i);
   return j;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void ABCPopulation::generateSolution(Bee &tmp, std::size_t i) {
+void ABCPopulation::generateSolution(Bee &tmp, std::size_t i, Random& random) {
   // Random index in population with k != i
-  std::size_t k = getRandomPopulationIndex(i);
+  std::size_t k = getRandomPopulationIndex(i, random);
 
   // Random index in the dimension
-  std::size_t j = m_random.randUInt(0, m_search_space.getNumberOfParameters()); // [0, m_search_space.getNumberOfParameters)
-
-  tmp[j] += m_random.rand(-1., 1.) * (tmp[j] - m_individuals[k][j]);
+  std::size_t j = random.randUInt(0, m_search_space.getNumberOfParameters()); // [0, m_search_space.getNumberOfParameters)
 
-  // Boundary check
-  checkBoundary(tmp);
-
-  // Evaluate the new solution
-  evaluate(tmp);
+  // The food sources are only read, possibly by several threads
+  const Bee& partner = m_individuals[k];
+  tmp[j] += random.rand(-1., 1.) * (tmp[j] - partner[j]);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
 void ABCPopulation::employedBeesEvaluation() {
   // Each employed bee xi generates a new candidate solution
-  // in the neighborhood of its present position
-  Bee tmp;
-  m_fitness_sum = 0.;
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) { // loop on population
-    tmp = m_individuals[i];
+  // in the neighborhood of its present position. The food sources are
+  // only read, and each bee draws from its own random stream.
+  std::size_t n = std::min(m_individuals.size(), getRemainingEvaluations());
+
+  auto employed = [this](std::size_t i) {
+    const Bee& source = m_individuals[i];
+    Bee& tmp = m_candidates[i];
+    tmp = source;
+    generateSolution(tmp, i, m_bee_random[i]);
+    checkBoundary(tmp, m_bee_random[i]);
+
+    // The new solution differs from the food source in one coordinate
+    evaluateInto(tmp, source);
+  };
+  forEach(n, employed);
 
-    // Generate a new solution
-    generateSolution(tmp, i);
+  for (std::size_t i = 0; i < n; ++i) { // loop on population
+    track(m_candidates[i]);
 
-    // Greedy selection: if the fitness value of tmp is better than m_individuals[i]
-    // then update m_individuals[i] with tmp, otherwise keep m_individuals[i] unchanged
-    if (tmp.getFitness() > m_individuals[i].getFitness()) {
-      m_individuals[i] = tmp;
+    // Greedy selection: if the fitness value of the candidate is better than m_individuals[i]
+    // then update m_individuals[i] with the candidate, otherwise keep m_individuals[i] unchanged
+    if (m_candidates[i].getFitness() > m_individuals[i].getFitness()) {
+      std::swap(m_individuals[i], m_candidates[i]);
       m_trial[i] = 0;
     } else {
       m_trial[i]++;
     }
-
-    m_fitness_sum += m_individuals[i].getFitness();
   }
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -138,8 +121,9 @@ void ABCPopulation::employedBeesEvaluation() {
 
 void ABCPopulation::computeProbabilities() {
   for (std::size_t i = 0; i < m_individuals.size(); ++i) { // loop on population
-    m_prob[i] = m_individuals[i].getFitness() / m_fitness_sum;
+    m_prob[i] = m_individuals[i].getFitness();
   }
+  m_selector.set(m_prob);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
@@ -152,15 +136,17 @@ void ABCPopulation::onlookerBeesEvaluation() {
   computeProbabilities();
 
   bool discarded_solutions = false;
-  std::discrete_distribution<> p(m_prob.begin(), m_prob.end());
-  Bee tmp;
+  Bee& tmp = m_candidates[0];
   std::size_t sel = 0;
   for (std::size_t k = 0; k < m_onlookers; ++k) {
-    sel = m_random.rand();
+    if (isBudgetExhausted()) return;
+    sel = m_selector.select(m_random.rand());
     tmp = m_individuals[sel];
 
     // generate a new solution
-    generateSolution(tmp, k);
+    generateSolution(tmp, sel, m_random);
+    checkBoundary(tmp);
+    evaluate(tmp, m_individuals[sel]);
 
     // greedy selection: if the fitness value of tmp is better than m_individuals[i]
     // then update m_individuals[i] with tmp, otherwise keep m_individuals[i] unchanged
@@ -173,7 +159,7 @@ void ABCPopulation::onlookerBeesEvaluation() {
 
     // If a position cannot be improved over a predefined number (called limit)
     // of cycles, then the food source is abandoned
-    if (m_trial[sel] > (int)m_limit_scout) {
+    if (m_trial[sel] > (int)m_limit_scout && !isBudgetExhausted()) {
       m_individuals[sel].setPosition(m_search_space.getRandom());
       evaluate(m_individuals[sel]);
       m_trial[sel] = 0;
@@ -181,36 +167,17 @@ void ABCPopulation::onlookerBeesEvaluation() {
     }
   }
 
-  // if no solution was discarded, generate new random solutions
+  // if no solution was discarded, the scout bees abandon the food
+  // sources that were not improved for more than limit cycles
   if (discarded_solutions) return;
 
-  std::size_t s = 0;
   for (std::size_t k = 0; k < m_scouters; ++k) {
-    s = m_random.randUInt(0, m_individuals.size()); // [0, m_individuals.size)
+    if (isBudgetExhausted()) return;
+    std::size_t s = std::max_element(m_trial.begin(), m_trial.end()) - m_trial.begin();
+    if (m_trial[s] <= (int)m_limit_scout) return;
     m_individuals[s].setPosition(m_search_space.getRandom());
     evaluate(m_individuals[s]);
+    m_trial[s] = 0;
   }
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void ABCPopulation::evaluate() {
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-    evaluate(m_individuals[i]);
-  }
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void ABCPopulation::evaluate(Bee& solution) {
-  double value = evaluateCost(solution.getPosition());
-  solution.setCost(value);
-
-  if (value < m_best_solution.getCost()) {
-    if (ckeckViolateConstraints(solution.getPosition()) == false) {
-      m_best_solution = solution;
-    }
-  };
-
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
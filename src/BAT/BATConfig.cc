@@ -17,6 +17,7 @@
 
 
 #include <BAT/BATConfig.h>
+#include <algorithm>
 
 using namespace EmiROOT;
 
@@ -27,6 +28,7 @@ BATConfig::BATConfig() : Config() {
   m_gamma              = 0.;
   m_fmax               = 0.;
   m_fmin               = 0.;
+  m_batch_size         = 4;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
@@ -61,6 +63,11 @@ void BATConfig::setMaxFrequency(double t) {
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
+void BATConfig::setBatchSize(std::size_t t) {
+  m_batch_size = std::max<std::size_t>(1, t);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
 
 double BATConfig::getInitialLoudness() const {
   return m_initial_loudness;
@@ -91,3 +98,8 @@ double BATConfig::getMaxFrequency() const {
   return m_fmax;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+std::size_t BATConfig::getBatchSize() const {
+  return m_batch_size;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
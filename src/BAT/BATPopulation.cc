@@ -20,7 +20,7 @@
 
 using namespace EmiROOT;
 
-BATPopulation::BATPopulation(Function func) : Population(func) {}
+BATPopulation::BATPopulation(Function func) : PopulationBase(func) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
@@ -31,24 +31,26 @@ void BATPopulation::init() {
   m_pulse_rate = m_config.getInitialPulseRate() * (1 - exp(-m_config.getGamma()));
   m_individuals.resize(pop_size, Bat(d));
 
-  if (m_initial_population.size() > 0) {
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
 
-    // Load the positions provided by the user
-    for (std::size_t i = 0; i < (std::size_t) m_initial_population.size(); ++i) {
-      m_individuals[i].setPosition(m_initial_population[i]);
-    }
-
-  } else {
+  if (n_loaded < m_individuals.size()) {
 
-    // Generate randomly the position of the individuals
+    // Generate randomly the position of the other individuals
     if (!m_silent) std::cout << "Generating the initial population...\n";
-    for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+    for (std::size_t i = n_loaded; i < m_individuals.size(); ++i) {
       m_individuals[i].setFrequency(m_random.rand(m_config.getMinFrequency(), m_config.getMaxFrequency()));
       m_individuals[i].setPosition(m_search_space.getRandom());
     }
 
   }
 
+  // Candidate and random stream of each bat
+  m_candidates.assign(pop_size, Bat(d));
+  m_accept.assign(pop_size, false);
+  m_bat_random.clear();
+  for (std::size_t i = 0; i < pop_size; ++i) m_bat_random.push_back(m_random.split());
+
   // Dummy assignment of the best individual. When the cost of
   // the population is actually evaluated this is fixed.
   m_best_solution = m_individuals[0];
@@ -56,26 +58,6 @@ void BATPopulation::init() {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void BATPopulation::setConfig(const BATConfig& t_config) {
-  m_config = t_config;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-std::vector<std::vector<double> > BATPopulation::getPopulationPosition() {
-  std::vector<std::vector<double> > positions(m_individuals.size());
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) positions[i] = m_individuals[i].getPosition();
-  return positions;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-Bat* BATPopulation::getBestSolution() {
-  return &m_best_solution;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
 void BATPopulation::updateLoudnessAndPulse(std::size_t t) {
   m_loudness = m_config.getAlpha() * m_loudness;
   m_pulse_rate = m_config.getInitialPulseRate() * (1 - exp(-m_config.getGamma() * (t+1)));
@@ -84,45 +66,66 @@ void BATPopulation::updateLoudnessAndPulse(std::size_t t) {
 
 
 void BATPopulation::moveBats() {
+  // The bats are moved in batches of fixed size, and the best solution is
+  // updated after each batch: with a batch of 1 this is the sequential
+  // algorithm, where each bat sees the best solution found by the previous
+  // one. Within a batch the best solution is only read, and each bat
+  // updates its own velocity and candidate from its own random stream.
+  std::size_t n = std::min(m_individuals.size(), getRemainingEvaluations());
   std::size_t d = m_search_space.getNumberOfParameters();
-  double v = 0.;
-  bool update_p = false;
-  bool update_l = false;
-  Bat tmp(d);
 
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) { // loop on population
+  auto fly = [this, d](std::size_t i) {
+    Bat& bat = m_individuals[i];
+    Bat& candidate = m_candidates[i];
+    Random& random = m_bat_random[i];
+    const Bat& best = m_best_solution;
 
-    update_p = m_random.rand() < m_pulse_rate ? true : false;
-    update_l = m_random.rand() < m_loudness ? true : false;
+    bool update_p = random.rand() < m_pulse_rate ? true : false;
+    m_accept[i] = random.rand() < m_loudness ? true : false;
 
-    // update the frequency
-    tmp.setFrequency(m_random.rand(m_config.getMinFrequency(), m_config.getMaxFrequency()));
+    // every bat gets its new frequency and velocity
+    bat.setFrequency(random.rand(m_config.getMinFrequency(), m_config.getMaxFrequency()));
+    double* v = bat.getVelocity().data();
+    const double* x_bat = static_cast<const Bat&>(bat).getPosition().data();
+    double freq = bat.getFrequency();
+    for (std::size_t j = 0; j < d; ++j) { // loop on dimension
+      v[j] = v[j] + (x_bat[j] - best[j])*freq;
+    }
 
-    // update position and velocity
+    // the new position is a candidate, kept depending on the loudness
+    candidate = bat;
+    double* x = candidate.getPosition().data();
     for (std::size_t j = 0; j < d; ++j) { // loop on dimension
-      v = tmp.getVelocity(j) + (tmp[j] - m_best_solution[j])*tmp.getFrequency();
-      tmp.setVelocity(j, v);
-      tmp[j] = tmp[j] + v;
+      x[j] = x[j] + v[j];
 
       // improving the best solution
       if (update_p) {
-        tmp[j] = m_best_solution[j] + m_random.rand(-1., 1.)*m_loudness;
+        x[j] = best[j] + random.rand(-1., 1.)*m_loudness;
       }
     }
 
     // boundary check
-    checkBoundary(tmp);
+    checkBoundary(candidate, random);
 
     // evaluate
-    evaluate(tmp);
+    evaluateInto(candidate);
+  };
 
-    // conditionally save of the new solution
-    if (update_l && tmp.getCost() < m_individuals[i].getCost()) {
-      m_individuals[i] = tmp;
-    }
+  std::size_t batch_size = m_config.getBatchSize();
+  for (std::size_t first = 0; first < n; first += batch_size) {
+    std::size_t batch = std::min(batch_size, n - first);
+    forEach(batch, [&fly, first](std::size_t k) {fly(first + k);});
+
+    for (std::size_t i = first; i < first + batch; ++i) {
+      // update the best solution
+      track(m_candidates[i]);
 
-    // update the best solution
-    // this is done automatically when evaluating tmp
+      // conditionally save of the new position, the velocity being
+      // already updated
+      if (m_accept[i] && m_candidates[i].getCost() < m_individuals[i].getCost()) {
+        m_individuals[i] = m_candidates[i];
+      }
+    }
   }
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -138,24 +141,3 @@ double BATPopulation::getLoudness() const {
   return m_loudness;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void BATPopulation::evaluate() {
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-    evaluate(m_individuals[i]);
-  }
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void BATPopulation::evaluate(Bat& solution) {
-  double value = evaluateCost(solution.getPosition());
-  solution.setCost(value);
-
-  if (value < m_best_solution.getCost()) {
-    if (ckeckViolateConstraints(solution.getPosition()) == false) {
-      m_best_solution = solution;
-    }
-  };
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
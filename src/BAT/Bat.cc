@@ -17,6 +17,7 @@
 
 
 #include <BAT/Bat.h>
+#include <algorithm>
 
 using namespace EmiROOT;
 
@@ -21,17 +21,24 @@
 using namespace EmiROOT;
 
 Algorithm::Algorithm(Function obj_function) :
+  m_observed_best_cost(std::numeric_limits<double>::max()),
   m_obj_function(obj_function),
+  m_delta_max_changed(1),
+  m_n_threads(1),
   m_pop_out_file_name(""),
   m_save_population(false),
   m_silent(false),
   m_maximize(false),
   m_oob_sol(RBC),
-  m_algo_name("") {
-    m_progress_bar.set_bar_width(50);
-    m_progress_bar.fill_bar_progress_with("■");
-    m_progress_bar.fill_bar_remainder_with(" ");
-  }
+  m_algo_name(""),
+  m_iter(0),
+  m_population_base(nullptr),
+  m_constrained_method(""),
+  m_penalty_scaling(10.),
+  m_start_penalty_param(2.),
+  m_max_penalty_param(1.e10),
+  m_initial_design(UNIFORM),
+  m_max_trials(10000) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
@@ -45,6 +52,8 @@ void Algorithm::setParameters(const Parameters& parameters) {
   int n = parameters.size();
   m_search_space = SearchSpace(n);
   m_search_space.setConstraints(m_constraints);
+  m_search_space.setInitialDesign(m_initial_design);
+  m_search_space.setCostrInitPopMaxTrials(m_max_trials);
   m_parameter_range = std::vector<std::vector<double> >(n);
 
   for (int i = 0; i < n; ++i) {
@@ -130,6 +139,49 @@ void Algorithm::setCostrInitPop(bool t) {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
+void Algorithm::setCostrInitPopMaxTrials(std::size_t t) {
+  m_max_trials = t;
+  m_search_space.setCostrInitPopMaxTrials(t);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Algorithm::setInitialDesign(std::string t) {
+  if (t == "UNIFORM") {
+    m_initial_design = UNIFORM;
+  } else if (t == "SOBOL") {
+    m_initial_design = SOBOL;
+  } else if (t == "HALTON") {
+    m_initial_design = HALTON;
+  } else if (t == "LHS") {
+    m_initial_design = LHS;
+  } else if (t == "MAXIMIN_LHS") {
+    m_initial_design = MAXIMIN_LHS;
+  }
+  m_search_space.setInitialDesign(m_initial_design);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Algorithm::setDeltaFunction(const DeltaFunction& t, std::size_t t_max_changed) {
+  m_delta_function = t;
+  m_delta_max_changed = t_max_changed;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Algorithm::setNThreads(std::size_t t) {
+  m_n_threads = std::max((std::size_t) 1, t);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Algorithm::addObserver(Observer* t) {
+  m_observers.push_back(t);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
 double Algorithm::rand() {
   return m_search_space.rand();
 }
@@ -142,10 +194,78 @@ void Algorithm::addPopulationPosition(std::vector<std::vector<double> > v) {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
+void Algorithm::startObservers() {
+  m_observed_best_cost = std::numeric_limits<double>::max();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Algorithm::notifyIteration(Population& t_population, std::size_t t_max_iter) {
+  double best_cost = t_population.getBestSolution()->getCost();
+  bool new_best = best_cost < m_observed_best_cost;
+  if (new_best) m_observed_best_cost = best_cost;
+
+  // Statistics are computed only if some observer is invoked
+  bool progress = !m_silent && m_progress_observer.isDue(m_iter);
+  bool invoke = progress;
+  for (Observer* observer : m_observers) {
+    if (new_best || observer->isDue(m_iter)) invoke = true;
+  }
+  if (!invoke) return;
+
+  PopulationView view(t_population);
+  IterationStats stats = getIterationStats(t_population, t_max_iter);
+  if (progress) m_progress_observer.onIterationEnd(view, stats);
+  for (Observer* observer : m_observers) {
+    if (new_best) observer->onNewBest(view, stats);
+    if (observer->isDue(m_iter)) observer->onIterationEnd(view, stats);
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Algorithm::notifyTermination(Population& t_population, std::size_t t_max_iter) {
+  if (m_silent && m_observers.empty()) return;
+
+  PopulationView view(t_population);
+  IterationStats stats = getIterationStats(t_population, t_max_iter);
+  if (!m_silent) m_progress_observer.onTermination(view, stats);
+  for (Observer* observer : m_observers) observer->onTermination(view, stats);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+IterationStats Algorithm::getIterationStats(Population& t_population, std::size_t t_max_iter) {
+  IterationStats stats;
+  stats.iteration      = m_iter;
+  stats.max_iterations = t_max_iter;
+  stats.evaluations    = t_population.getNEvaluations();
+  stats.elapsed_time   = m_profiler.getElapsedTime();
+
+  double sum = 0.;
+  double worst = -std::numeric_limits<double>::max();
+  std::size_t n = t_population.getSize();
+  for (std::size_t i = 0; i < n; ++i) {
+    double cost = t_population.getIndividual(i)->getCost();
+    sum += cost;
+    if (cost > worst) worst = cost;
+  }
+
+  // Costs are stored with the sign changed when maximizing
+  double sign = m_maximize ? -1. : 1.;
+  stats.best_cost  = sign*t_population.getBestSolution()->getCost();
+  stats.mean_cost  = n > 0 ? sign*sum/n : 0.;
+  stats.worst_cost = sign*worst;
+  return stats;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
 OptimizationResults Algorithm::getResults() {
   OptimizationResults result;
   result.algorithm       = m_algo_name;
   result.iterations      = m_iter;
+  result.evaluations     = m_population_base->getNEvaluations();
   result.population_size = m_population_base->getSize();
   result.obj_function    = m_obj_function;
   result.constraints     = m_constraints;
@@ -156,6 +276,12 @@ OptimizationResults Algorithm::getResults() {
   result.parameter_names = m_parameter_names;
   result.cost_history    = m_cost_history;
   result.is_maximization = m_maximize;
+  result.performance     = m_profiler.getReport();
+  result.performance.evaluations = result.evaluations;
+  const SearchSpace& space = m_population_base->getSearchSpace();
+  result.sampling.generated  = space.getNGenerated();
+  result.sampling.rejected   = space.getNRejected();
+  result.sampling.infeasible = space.getNInfeasible();
   return result;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
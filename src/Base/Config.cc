@@ -24,6 +24,8 @@ Config::Config() {
   m_nmax_iter = 0.;
   m_nmax_iter_scost = 0.;
   m_absolute_tol = 0.;
+  m_nparticles = 0;
+  m_nmax_eval = 0;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
@@ -51,6 +53,12 @@ void Config::setPopulationSize(std::size_t t) {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
+void Config::setMaxEvaluations(std::size_t t) {
+  m_nmax_eval = t;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
 std::size_t Config::getNMaxIterations() const {
   return m_nmax_iter;
 }
@@ -73,6 +81,12 @@ std::size_t Config::getPopulationSize() const {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
+std::size_t Config::getMaxEvaluations() const {
+  return m_nmax_eval;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
 void addPopulationPosition(const std::vector<double>&) {
 
 }
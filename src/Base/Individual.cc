@@ -21,26 +21,33 @@
 using namespace EmiROOT;
 
 Individual::Individual() :
-m_position(0) {}
+m_position(0),
+m_violation(0.),
+m_evaluated(false) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
 Individual::Individual(int n) :
 m_position(n, 0),
-m_has_velocity(false) {
+m_violation(0.),
+m_has_velocity(false),
+m_evaluated(false) {
   m_cost = std::numeric_limits<double>::max();
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void Individual::setCost(double t) {
+void Individual::setCost(double t, double t_violation) {
   m_cost = t;
+  m_violation = t_violation;
+  m_evaluated = true;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
 void Individual::setPosition(const Point& t) {
   m_position = t;
+  m_evaluated = false;
 }
 
 std::size_t Individual::getDimension() const {
@@ -49,7 +56,7 @@ std::size_t Individual::getDimension() const {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-double Individual::getCost() {
+double Individual::getCost() const {
   return m_cost;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -0,0 +1,340 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <Base/InitialDesign.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace EmiROOT;
+
+namespace {
+
+  // Product of two polynomials over GF(2) modulo p, of degree s
+  uint64_t mulMod(uint64_t a, uint64_t b, uint64_t p, unsigned s) {
+    uint64_t r = 0;
+    while (b) {
+      if (b & 1) r ^= a;
+      b >>= 1;
+      a <<= 1;
+      if (a >> s & 1) a ^= p;
+    }
+    return r;
+  }
+
+  // Power of the polynomial x modulo p, of degree s
+  uint64_t powX(uint64_t e, uint64_t p, unsigned s) {
+    uint64_t r = 1, a = s > 1 ? 2 : 2 ^ p;
+    while (e) {
+      if (e & 1) r = mulMod(r, a, p, s);
+      e >>= 1;
+      a = mulMod(a, a, p, s);
+    }
+    return r;
+  }
+
+  // A polynomial of degree s is primitive if x has order 2^s - 1 modulo it
+  bool isPrimitive(uint64_t p, unsigned s, const std::vector<uint64_t>& factors) {
+    uint64_t order = (uint64_t(1) << s) - 1;
+    if (powX(order, p, s) != 1) return false;
+    for (uint64_t q : factors) {
+      if (powX(order/q, p, s) == 1) return false;
+    }
+    return true;
+  }
+
+  // Prime factors of n
+  std::vector<uint64_t> primeFactors(uint64_t n) {
+    std::vector<uint64_t> factors;
+    for (uint64_t q = 2; q*q <= n; ++q) {
+      if (n % q) continue;
+      factors.push_back(q);
+      while (n % q == 0) n /= q;
+    }
+    if (n > 1) factors.push_back(n);
+    return factors;
+  }
+
+  // Parity of the bits of x
+  uint32_t parity(uint32_t x) {
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    x ^= x >> 2;
+    x ^= x >> 1;
+    return x & 1;
+  }
+
+  // Number of trailing zeros of i > 0
+  unsigned trailingZeros(std::size_t i) {
+    unsigned c = 0;
+    while (!(i & 1)) {
+      i >>= 1;
+      c++;
+    }
+    return c;
+  }
+
+  // Term of the Morris-Mitchell criterion, with p = 10, of two points at
+  // the given squared distance
+  double phiTerm(double d2) {
+    double r = 1./std::max(d2, std::numeric_limits<double>::min());
+    return r*r*r*r*r;
+  }
+
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+InitialDesign::InitialDesign() : m_type(UNIFORM), m_active(false), m_n(0), m_d(0), m_index(0) {}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void InitialDesign::start(std::size_t n, std::size_t d, Random& random) {
+  m_n = n;
+  m_d = d;
+  m_index = 0;
+  m_active = m_type != UNIFORM && n > 0 && d > 0;
+  if (!m_active) return;
+
+  switch (m_type) {
+    case SOBOL:  startSobol(random); break;
+    case HALTON: startHalton(random); break;
+    default:
+      startLatinHypercube(random);
+      if (m_type == MAXIMIN_LHS) spreadLatinHypercube(random);
+      break;
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void InitialDesign::stop() {
+  m_active = false;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+bool InitialDesign::next(double* t) {
+  if (!m_active) return false;
+
+  if (m_type == SOBOL) {
+
+    // Gray code order: each point differs from the previous one by the
+    // direction number of the lowest zero bit of its index
+    if (m_index > 0) {
+      unsigned c = trailingZeros(m_index);
+      for (std::size_t j = 0; j < m_d; ++j) m_state[j] ^= m_directions[32*j + c];
+    }
+    for (std::size_t j = 0; j < m_d; ++j) t[j] = (m_state[j] + 0.5)*std::ldexp(1., -32);
+    if (++m_index == (std::size_t(1) << 32) - 1) m_active = false;
+
+  } else if (m_type == HALTON) {
+
+    // Radical inverse of the index in the base of each dimension, with
+    // the digits scrambled. The zero digits above the most significant
+    // one of the index add the precomputed tail.
+    for (std::size_t j = 0; j < m_d; ++j) {
+      unsigned b = m_bases[j];
+      double scale = 1./b, x = 0.;
+      std::size_t i = m_index;
+      for (std::size_t k = m_offsets[j]; k < m_offsets[j + 1]; ++k) {
+        if (i == 0) {
+          x += m_tails[k];
+          break;
+        }
+        unsigned a = i % b;
+        i /= b;
+        x += (((uint64_t) m_digits[2*k]*a + m_digits[2*k + 1]) % b)*scale;
+        scale /= b;
+      }
+      t[j] = x;
+    }
+    m_index++;
+
+  } else {
+
+    std::copy_n(m_points.begin() + m_index*m_d, m_d, t);
+    if (++m_index == m_n) m_active = false;
+
+  }
+
+  return true;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void InitialDesign::startSobol(Random& random) {
+  // The first dimension is the van der Corput sequence in base 2. Each of
+  // the others is defined by a primitive polynomial over GF(2), taken by
+  // increasing degree, and by random odd initial direction numbers, which
+  // the recurrence of the polynomial extends to 32 bits
+  m_directions.assign(32*m_d, 0);
+  for (unsigned k = 0; k < 32; ++k) m_directions[k] = uint32_t(1) << (31 - k);
+
+  std::size_t j = 1;
+  std::vector<uint32_t> m(33);
+  for (unsigned s = 1; j < m_d && s < 32; ++s) {
+    std::vector<uint64_t> factors = primeFactors((uint64_t(1) << s) - 1);
+    for (uint64_t p = (uint64_t(1) << s) | 1; j < m_d && p < (uint64_t(1) << (s + 1)); p += 2) {
+      if (!isPrimitive(p, s, factors)) continue;
+
+      for (unsigned k = 1; k <= s; ++k) m[k] = 2*random.randUInt(0, uint64_t(1) << (k - 1)) + 1;
+      for (unsigned k = s + 1; k <= 32; ++k) {
+        m[k] = m[k - s] ^ (m[k - s] << s);
+        for (unsigned i = 1; i < s; ++i) {
+          if (p >> (s - i) & 1) m[k] ^= m[k - i] << i;
+        }
+      }
+      for (unsigned k = 1; k <= 32; ++k) m_directions[32*j + k - 1] = m[k] << (32 - k);
+      j++;
+    }
+  }
+
+  // Random linear scrambling: the bit r of a direction number, counted
+  // from the most significant one, is mixed with the more significant
+  // bits by a random lower triangular matrix with unit diagonal
+  uint32_t mask[32];
+  for (std::size_t j = 0; j < m_d; ++j) {
+    for (unsigned r = 0; r < 32; ++r) {
+      uint32_t bit = uint32_t(1) << (31 - r);
+      uint32_t above = r > 0 ? ~((bit << 1) - 1) : 0;
+      mask[r] = ((uint32_t) random.randUInt(0, uint64_t(1) << 32) & above) | bit;
+    }
+    for (unsigned k = 0; k < 32; ++k) {
+      uint32_t v = m_directions[32*j + k], w = 0;
+      for (unsigned r = 0; r < 32; ++r) w |= parity(mask[r] & v) << (31 - r);
+      m_directions[32*j + k] = w;
+    }
+  }
+
+  // Random digital shift, which is the first point
+  m_state.resize(m_d);
+  for (std::size_t j = 0; j < m_d; ++j) m_state[j] = (uint32_t) random.randUInt(0, uint64_t(1) << 32);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void InitialDesign::startHalton(Random& random) {
+  // First d prime numbers
+  m_bases.clear();
+  for (unsigned q = 2; m_bases.size() < m_d; ++q) {
+    bool prime = true;
+    for (unsigned b : m_bases) {
+      if (b*b > q) break;
+      if (q % b == 0) {
+        prime = false;
+        break;
+      }
+    }
+    if (prime) m_bases.push_back(q);
+  }
+
+  // Each digit a of each dimension becomes (f a + g) mod b, with f in
+  // [1, b) and g in [0, b) drawn at random: the map is a permutation of
+  // the digits since b is prime. The digits are scrambled down to the
+  // precision of a double.
+  m_digits.clear();
+  m_offsets.assign(1, 0);
+  for (unsigned b : m_bases) {
+    for (double scale = 1./b; scale*b > std::ldexp(1., -52); scale /= b) {
+      m_digits.push_back((unsigned) random.randUInt(1, b));
+      m_digits.push_back((unsigned) random.randUInt(0, b));
+    }
+    m_offsets.push_back(m_digits.size()/2);
+  }
+
+  // Contribution of the zero digits from each position on
+  m_tails.resize(m_offsets.back());
+  for (std::size_t j = 0; j < m_d; ++j) {
+    double scale = std::pow((double) m_bases[j], -(double) (m_offsets[j + 1] - m_offsets[j])), tail = 0.;
+    for (std::size_t k = m_offsets[j + 1]; k-- > m_offsets[j];) {
+      tail += m_digits[2*k + 1]*scale;
+      m_tails[k] = tail;
+      scale *= m_bases[j];
+    }
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void InitialDesign::startLatinHypercube(Random& random) {
+  // Each parameter is split in n slices, each taken by one point at a
+  // random position within it; the slices are assigned to the points by a
+  // random permutation for each parameter
+  std::vector<std::size_t> slice(m_n);
+  m_points.resize(m_n*m_d);
+  for (std::size_t j = 0; j < m_d; ++j) {
+    for (std::size_t i = 0; i < m_n; ++i) slice[i] = i;
+    for (std::size_t i = m_n - 1; i > 0; --i) std::swap(slice[i], slice[random.randUInt(0, i + 1)]);
+    for (std::size_t i = 0; i < m_n; ++i) m_points[i*m_d + j] = (slice[i] + random.rand())/m_n;
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void InitialDesign::spreadLatinHypercube(Random& random) {
+  // Exchanging a coordinate of two points keeps the Latin hypercube and
+  // changes only their distances to the others, so the change of the
+  // criterion sum_{i<k} 1/d_ik^10, dominated by the closest pairs, costs
+  // O(n). 20 n d exchanges are tried, up to about 1e8 operations, and the
+  // designs of more than 2000 points are not spread out.
+  std::size_t n = m_n, d = m_d;
+  if (n < 3 || n > 2000) return;
+
+  std::vector<double> dist2(n*n, 0.);
+  for (std::size_t a = 0; a < n; ++a) {
+    for (std::size_t b = a + 1; b < n; ++b) {
+      double s = 0.;
+      for (std::size_t j = 0; j < d; ++j) {
+        double u = m_points[a*d + j] - m_points[b*d + j];
+        s += u*u;
+      }
+      dist2[a*n + b] = dist2[b*n + a] = s;
+    }
+  }
+
+  std::vector<double> new_a(n), new_b(n);
+  std::size_t n_exchanges = std::min<std::size_t>(20*n*d, 100000000/n);
+  for (std::size_t e = 0; e < n_exchanges; ++e) {
+    std::size_t j = random.randUInt(0, d);
+    std::size_t a = random.randUInt(0, n);
+    std::size_t b = random.randUInt(0, n - 1);
+    if (b >= a) b++;
+
+    double xa = m_points[a*d + j], xb = m_points[b*d + j];
+    double delta = 0.;
+    for (std::size_t m = 0; m < n; ++m) {
+      if (m == a || m == b) continue;
+      double xm = m_points[m*d + j];
+      double ua = xa - xm, ub = xb - xm;
+      new_a[m] = dist2[a*n + m] - ua*ua + ub*ub;
+      new_b[m] = dist2[b*n + m] - ub*ub + ua*ua;
+      delta += phiTerm(new_a[m]) - phiTerm(dist2[a*n + m]) + phiTerm(new_b[m]) - phiTerm(dist2[b*n + m]);
+    }
+    if (delta >= 0.) continue;
+
+    std::swap(m_points[a*d + j], m_points[b*d + j]);
+    for (std::size_t m = 0; m < n; ++m) {
+      if (m == a || m == b) continue;
+      dist2[a*n + m] = dist2[m*n + a] = new_a[m];
+      dist2[b*n + m] = dist2[m*n + b] = new_b[m];
+    }
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
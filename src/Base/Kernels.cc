@@ -0,0 +1,162 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <Base/Kernels.h>
+#include <algorithm>
+#include <cmath>
+#include <stdint.h>
+#include <string.h>
+
+using namespace EmiROOT;
+
+namespace {
+
+  // Adding then subtracting 1.5*2^52 rounds a double to the nearest
+  // integer, which is left in the low bits of the sum
+  const double shifter = 6755399441055744.;
+
+  const double two_pi = 6.283185307179586477;
+
+  // exp(x) = 2^k exp(r), with k = round(x/ln2) and |r| <= ln2/2 computed
+  // with the split ln2 of fdlibm, so that k ln2 is exact
+  inline double expKernel(double x) {
+    const double log2e  = 1.44269504088896340736;
+    const double ln2_hi = 6.93147180369123816490e-01;
+    const double ln2_lo = 1.90821492927058770002e-10;
+
+    x = x < -708. ? -708. : x;
+    x = x > 709. ? 709. : x;
+    double kd = x*log2e + shifter;
+    uint64_t bits;
+    memcpy(&bits, &kd, sizeof(bits));
+    kd -= shifter;
+    double r = (x - kd*ln2_hi) - kd*ln2_lo;
+
+    // Taylor series up to r^13, truncation error below 1e-17
+    double p = 1./6227020800.;
+    p = p*r + 1./479001600.;
+    p = p*r + 1./39916800.;
+    p = p*r + 1./3628800.;
+    p = p*r + 1./362880.;
+    p = p*r + 1./40320.;
+    p = p*r + 1./5040.;
+    p = p*r + 1./720.;
+    p = p*r + 1./120.;
+    p = p*r + 1./24.;
+    p = p*r + 1./6.;
+    p = p*r + 0.5;
+    p = p*r + 1.;
+    p = p*r + 1.;
+
+    // 2^k, from the low bits of the shifted value
+    uint64_t e = (bits + 1023) << 52;
+    double scale;
+    memcpy(&scale, &e, sizeof(scale));
+    return p*scale;
+  }
+
+  // cos(2 pi t) = -sin(2 pi (u - 1/4)), with u = |t - round(t)| in
+  // [0, 1/2] by periodicity and symmetry
+  inline double cos2PiKernel(double t) {
+    double u = std::fabs(t - ((t + shifter) - shifter));
+    double x = two_pi*(u - 0.25);
+
+    // Taylor series of sin up to x^21 for x in [-pi/2, pi/2], truncation
+    // error below 1e-17
+    double x2 = x*x;
+    double p = 1./51090942171709440000.;
+    p = -p*x2 + 1./121645100408832000.;
+    p = -p*x2 + 1./355687428096000.;
+    p = -p*x2 + 1./1307674368000.;
+    p = -p*x2 + 1./6227020800.;
+    p = -p*x2 + 1./39916800.;
+    p = -p*x2 + 1./362880.;
+    p = -p*x2 + 1./5040.;
+    p = -p*x2 + 1./120.;
+    p = -p*x2 + 1./6.;
+    p = -p*x2 + 1.;
+    return -p*x;
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Kernels::exp(const double* x, double* y, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) y[i] = expKernel(x[i]);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Kernels::cos2Pi(const double* t, double* y, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) y[i] = cos2PiKernel(t[i]);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Kernels::spiral(double* x, const double* target, double factor, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) x[i] = std::fabs(target[i] - x[i])*factor + target[i];
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Kernels::spiral(double* x, const double* target, const double* l, double b, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    x[i] = std::fabs(target[i] - x[i])*expKernel(b*l[i])*cos2PiKernel(l[i]) + target[i];
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Kernels::encircle(double* x, const double* target, double A, double C, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) x[i] = target[i] - A*std::fabs(C*target[i] - x[i]);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Kernels::encircle(double* x, const double* alpha, const double* beta, const double* delta,
+                       const double* r, double a, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    double X1 = alpha[i] - (2*a*r[i]       - a)*std::fabs(2*r[n + i]   * alpha[i] - x[i]);
+    double X2 = beta[i]  - (2*a*r[2*n + i] - a)*std::fabs(2*r[3*n + i] * beta[i]  - x[i]);
+    double X3 = delta[i] - (2*a*r[4*n + i] - a)*std::fabs(2*r[5*n + i] * delta[i] - x[i]);
+    x[i] = (X1 + X2 + X3)/3.;
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Kernels::velocity(double* v, const double* x, const double* best, const double* guide, const double* r,
+                       double w, double c1, double c2, const double* max_v, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    double cognitive = c1 * r[i] * (best[i] - x[i]);
+    double social    = c2 * r[n + i] * (guide[i] - x[i]);
+    double vel       = v[i] * w + cognitive + social;
+    v[i] = std::min(std::max(vel, -max_v[i]), max_v[i]);
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Kernels::differential(double* u, const double* x, const double* base, const double* p, const double* q,
+                           const double* s, const double* t, const double* r, double f, double g, double cr, std::size_t n) {
+  for (std::size_t i = 0; i < n; ++i) {
+    double mutant = base[i] + f * (p[i] - q[i]) + g * (s[i] - t[i]);
+    u[i] = r[i] < cr ? mutant : x[i];
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
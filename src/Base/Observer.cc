@@ -0,0 +1,42 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <Base/Observer.h>
+
+using namespace EmiROOT;
+
+ProgressBarObserver::ProgressBarObserver() :
+Observer(10) {
+  m_progress_bar.set_bar_width(50);
+  m_progress_bar.fill_bar_progress_with("■");
+  m_progress_bar.fill_bar_remainder_with(" ");
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void ProgressBarObserver::onIterationEnd(const PopulationView&, const IterationStats& t) {
+  m_progress_bar.update(100.*t.iteration/t.max_iterations);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void ProgressBarObserver::onTermination(const PopulationView&, const IterationStats& t) {
+  m_progress_bar.update(100.*t.iteration/t.max_iterations);
+  std::cout << "\n";
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
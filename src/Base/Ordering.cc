@@ -0,0 +1,70 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <Base/Ordering.h>
+
+using namespace EmiROOT;
+
+void Ordering::sort() {
+  std::sort(m_keys.begin(), m_keys.end());
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Ordering::partialSort(std::size_t k, std::size_t n) {
+  // Selecting first and sorting the best k is faster than the heap of
+  // std::partial_sort unless k is a tiny fraction of n
+  n = std::min(n, m_keys.size());
+  k = std::min(k, n);
+  if (k == 1) {
+    std::iter_swap(m_keys.begin(), std::min_element(m_keys.begin(), m_keys.begin() + n));
+    return;
+  }
+  select(k, n);
+  std::sort(m_keys.begin(), m_keys.begin() + k);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Ordering::select(std::size_t k, std::size_t n) {
+  n = std::min(n, m_keys.size());
+  if (k == 0 || k >= n) return;
+  std::nth_element(m_keys.begin(), m_keys.begin() + k, m_keys.begin() + n);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::size_t Ordering::update(std::size_t r, double cost) {
+  Key key = {cost, m_keys[r].index};
+  auto it = m_keys.begin() + r;
+
+  if (r > 0 && cost < m_keys[r-1].cost) {
+    // Better than before: shift towards the best
+    auto pos = std::upper_bound(m_keys.begin(), it, key);
+    std::move_backward(pos, it, it + 1);
+    *pos = key;
+    return pos - m_keys.begin();
+  }
+
+  // Worse or equal: shift towards the worst
+  auto pos = std::upper_bound(it + 1, m_keys.end(), key);
+  std::move(it + 1, pos, it);
+  *(pos - 1) = key;
+  return pos - 1 - m_keys.begin();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -22,11 +22,15 @@ using namespace EmiROOT;
 
 Population::Population(Function func) :
 m_obj_func(func),
+m_delta_max_changed(0),
 m_maximization(false),
 m_penalty_coeff(2.),
 m_penalty_scaling(10.),
 m_max_penalty_param(1.e10),
-m_silent(false) {}
+m_silent(false),
+m_profiler(nullptr),
+m_n_evaluations(0),
+m_max_evaluations(0) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
@@ -77,18 +81,54 @@ void Population::setSilent(bool t) {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
+void Population::setDeltaFunction(const DeltaFunction& t, std::size_t t_max_changed) {
+  m_delta_func = t;
+  m_delta_max_changed = t_max_changed;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::size_t Population::getRemainingEvaluations() const {
+  if (m_max_evaluations == 0) return std::numeric_limits<std::size_t>::max();
+  std::size_t n = m_n_evaluations;
+  return n < m_max_evaluations ? m_max_evaluations - n : 0;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Population::setNThreads(std::size_t t) {
+  if (t == getNThreads()) return;
+  if (t > 1) {
+    m_pool = std::make_shared<ThreadPool>(t);
+  } else {
+    m_pool.reset();
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+bool Population::canEvaluateConcurrently() const {
+  if (m_constraints.empty()) return true;
+  if (m_oob_sol == DIS) return false;
+  return m_constrained_method == "PENALTY" || m_constrained_method == "BARRIER";
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
 void Population::scalePenaltyCoeff() {
+  EMIROOT_PROFILE(m_profiler, PENALTY);
   m_penalty_coeff = std::min(m_max_penalty_param, m_penalty_coeff*m_penalty_scaling);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-bool Population::ckeckViolateConstraints(std::vector<double>& v) {
-  Function g;
+bool Population::ckeckViolateConstraints(const std::vector<double>& v) {
+  if (m_constraints.empty()) return false;
+  EMIROOT_PROFILE(m_profiler, CONSTRAINTS);
   Inequality inequality;
   double tmp_d;
   for (size_t i = 0; i < m_constraints.size(); ++i) {
-    g = m_constraints[i].getFunction();
+    const Function& g = m_constraints[i].getFunction();
     inequality = m_constraints[i].getInequality();
     tmp_d = g(v);
 
@@ -108,44 +148,48 @@ bool Population::ckeckViolateConstraints(std::vector<double>& v) {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-double Population::constraintsBarrierMethod(std::vector<double>& v) {
+double Population::constraintsBarrierMethod(const std::vector<double>& v) {
   if (ckeckViolateConstraints(v)) return std::numeric_limits<double>::max();
+  EMIROOT_PROFILE(m_profiler, OBJECTIVE);
   return m_obj_func(v);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-double Population::constraintsPenaltyMethod(std::vector<double>& v) {
-  Function g;
+double Population::constraintsPenaltyMethod(const std::vector<double>& v, double& violation) {
   Inequality inequality;
   double penalty = 0.;
   double tmp_d;
 
-  for (size_t i = 0; i < m_constraints.size(); ++i) {
-    g = m_constraints[i].getFunction();
-    inequality = m_constraints[i].getInequality();
-    tmp_d = g(v);
-
-    if ((inequality == Inequality::L && tmp_d >= 0) ||
-    (inequality == Inequality::LEQ && tmp_d > 0) ||
-    (inequality == Inequality::GEQ && tmp_d < 0) ||
-    (inequality == Inequality::G && tmp_d <= 0)) {
-      penalty += fabs(tmp_d);
+  {
+    EMIROOT_PROFILE(m_profiler, CONSTRAINTS);
+    for (size_t i = 0; i < m_constraints.size(); ++i) {
+      const Function& g = m_constraints[i].getFunction();
+      inequality = m_constraints[i].getInequality();
+      tmp_d = g(v);
+
+      if ((inequality == Inequality::L && tmp_d >= 0) ||
+      (inequality == Inequality::LEQ && tmp_d > 0) ||
+      (inequality == Inequality::GEQ && tmp_d < 0) ||
+      (inequality == Inequality::G && tmp_d <= 0)) {
+        penalty += fabs(tmp_d);
+      }
     }
   }
 
+  violation = penalty;
   if (m_maximization) penalty = -penalty;
 
-  tmp_d = m_obj_func(v);
+  {
+    EMIROOT_PROFILE(m_profiler, OBJECTIVE);
+    tmp_d = m_obj_func(v);
+  }
   return (tmp_d + m_penalty_coeff*penalty);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-double Population::evaluateCost(Point& v) {
-  double value;
-
-  // In case of integer parameters
+void Population::roundIntegerParameters(Point& v) {
   for (std::size_t j = 0; j < v.size(); ++j) {
     if (m_search_space[j].isInteger()) {
       v[j] = round(v[j]); // floor the parameter
@@ -156,10 +200,29 @@ double Population::evaluateCost(Point& v) {
       }
     }
   }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+double Population::evaluateCost(Point& v) {
+  double violation;
+  return evaluateCost(v, violation);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+double Population::evaluateCost(Point& v, double& violation) {
+  EMIROOT_PROFILE(m_profiler, EVALUATION);
+  double value;
+  violation = 0.;
+  m_n_evaluations++;
+
+  // In case of integer parameters
+  roundIntegerParameters(v);
 
   if (m_constrained_method == "PENALTY") {
 
-    value = constraintsPenaltyMethod(v);
+    value = constraintsPenaltyMethod(v, violation);
 
   } else if (m_constrained_method == "BARRIER") {
 
@@ -172,6 +235,7 @@ double Population::evaluateCost(Point& v) {
       v = m_search_space.getRandom();
     }
 
+    EMIROOT_PROFILE(m_profiler, OBJECTIVE);
     value = m_obj_func(v);
 
   }
@@ -184,7 +248,105 @@ double Population::evaluateCost(Point& v) {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
+double Population::evaluateCost(Point& v, const Point& parent, double parent_cost, double& violation) {
+  // The cost of the parent must be the value of the objective function
+  if (!m_delta_func || !m_constraints.empty() || parent_cost == std::numeric_limits<double>::max()) return evaluateCost(v, violation);
+  violation = 0.;
+
+  // In case of integer parameters
+  roundIntegerParameters(v);
+
+  // One set of buffers per thread, since evaluations can run concurrently
+  static thread_local std::vector<std::size_t> changed;
+  static thread_local std::vector<double>      old_values;
+  changed.clear();
+  old_values.clear();
+  if (changed.capacity() < m_delta_max_changed) {
+    changed.reserve(m_delta_max_changed);
+    old_values.reserve(m_delta_max_changed);
+  }
+  for (std::size_t j = 0; j < v.size(); ++j) {
+    if (v[j] != parent[j]) {
+      if (changed.size() == m_delta_max_changed) return evaluateCost(v, violation);
+      changed.push_back(j);
+      old_values.push_back(parent[j]);
+    }
+  }
+
+  EMIROOT_PROFILE(m_profiler, EVALUATION);
+  m_n_evaluations++;
+
+  // Costs are stored with the sign changed when maximizing
+  double value = m_maximization ? -parent_cost : parent_cost;
+  if (!changed.empty()) {
+    EMIROOT_PROFILE(m_profiler, OBJECTIVE);
+    value = m_delta_func(v, value, changed, old_values);
+  }
+
+  if (m_maximization) return -value;
+
+  return value;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+double Population::evaluateCost(Point& v, std::size_t j, double old_value, double parent_cost, double& violation) {
+  // The cost of the parent must be the value of the objective function
+  if (!m_delta_func || m_delta_max_changed == 0 || !m_constraints.empty() ||
+      parent_cost == std::numeric_limits<double>::max()) return evaluateCost(v, violation);
+  violation = 0.;
+
+  // In case of integer parameters
+  roundIntegerParameters(v);
+
+  // One set of buffers per thread, since evaluations can run concurrently
+  static thread_local std::vector<std::size_t> changed(1);
+  static thread_local std::vector<double>      old_values(1);
+  changed[0] = j;
+  old_values[0] = old_value;
+
+  EMIROOT_PROFILE(m_profiler, EVALUATION);
+  m_n_evaluations++;
+
+  // Costs are stored with the sign changed when maximizing
+  double value = m_maximization ? -parent_cost : parent_cost;
+  if (v[j] != old_value) {
+    EMIROOT_PROFILE(m_profiler, OBJECTIVE);
+    value = m_delta_func(v, value, changed, old_values);
+  }
+
+  if (m_maximization) return -value;
+
+  return value;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
 void Population::checkBoundary(Individual& t) {
+  applyBoundaryConditions(t, nullptr);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Population::checkBoundary(Individual& t, Random& random) {
+  applyBoundaryConditions(t, &random);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Population::checkBoundary(Individual& t, std::size_t j, Random& random) {
+  if (m_constraints.size() > 0 && m_oob_sol == DIS) {
+    applyBoundaryConditions(t, &random);
+    return;
+  }
+  EMIROOT_PROFILE(m_profiler, BOUNDARY);
+  applyBoundaryCondition(t, j, &random);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Population::applyBoundaryConditions(Individual& t, Random* random) {
+  EMIROOT_PROFILE(m_profiler, BOUNDARY);
   std::size_t d = m_search_space.getNumberOfParameters();
 
   if (m_constraints.size() > 0 && m_oob_sol == DIS) { // Disregard the out-of-bound solution and generate new ones (DIS)
@@ -194,36 +356,48 @@ void Population::checkBoundary(Individual& t) {
   } else {
 
     // loop on dimension
-    for (std::size_t j = 0; j < d; ++j) {
+    for (std::size_t j = 0; j < d; ++j) applyBoundaryCondition(t, j, random);
 
-      if (m_oob_sol == PBC) { // Periodic Boundary Condition (PBC)
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
-        if (t[j] < m_search_space[j].getMin()) t[j] = m_search_space[j].getMax() - fabs(t[j] - m_search_space[j].getMin());
-        if (t[j] > m_search_space[j].getMax()) t[j] = m_search_space[j].getMin() + fabs(m_search_space[j].getMax() - t[j]);
 
-        if (t[j] < m_search_space[j].getMin() || t[j] > m_search_space[j].getMax()) t[j] = m_search_space.getRandom(j);
+void Population::applyBoundaryCondition(Individual& t, std::size_t j, Random* random) {
+  // The position is read through a const reference, so that the
+  // individuals within the boundaries are not marked as changed
+  const Individual& c = t;
 
-      } else if (m_oob_sol == BAB) { // Place out-of-bound solutions back at the boundaries (BAB)
+  if (m_oob_sol == PBC) { // Periodic Boundary Condition (PBC)
 
-        if (t[j] < m_search_space[j].getMin()) t[j] = m_search_space[j].getMin();
-        if (t[j] > m_search_space[j].getMax()) t[j] = m_search_space[j].getMax();
+    if (c[j] < m_search_space[j].getMin()) t[j] = m_search_space[j].getMax() - fabs(c[j] - m_search_space[j].getMin());
+    if (c[j] > m_search_space[j].getMax()) t[j] = m_search_space[j].getMin() + fabs(m_search_space[j].getMax() - c[j]);
 
-      } else if (m_oob_sol == DIS) { // Disregard the out-of-bound solution and generate new ones (DIS)
+    if (c[j] < m_search_space[j].getMin() || c[j] > m_search_space[j].getMax()) {
+      t[j] = random ? random->rand(m_search_space[j].getMin(), m_search_space[j].getMax()) : m_search_space.getRandom(j);
+    }
 
-        if (t[j] < m_search_space[j].getMin() ||
-        t[j] > m_search_space[j].getMax()) t[j] = m_random.rand(m_search_space[j].getMin(), m_search_space[j].getMax());
+  } else if (m_oob_sol == BAB) { // Place out-of-bound solutions back at the boundaries (BAB)
 
-      } else if (m_oob_sol == RBC) { // Reflective Boundary Condition (RBC)
+    if (c[j] < m_search_space[j].getMin()) t[j] = m_search_space[j].getMin();
+    if (c[j] > m_search_space[j].getMax()) t[j] = m_search_space[j].getMax();
 
-        if (t[j] < m_search_space[j].getMin()) t[j] = 2 * m_search_space[j].getMin() - t[j];
-        if (t[j] > m_search_space[j].getMax()) t[j] = 2 * m_search_space[j].getMax() - t[j];
+  } else if (m_oob_sol == DIS) { // Disregard the out-of-bound solution and generate new ones (DIS)
 
-        if (t[j] < m_search_space[j].getMin() || t[j] > m_search_space[j].getMax()) t[j] = m_search_space.getRandom(j);
+    if (c[j] < m_search_space[j].getMin() ||
+    c[j] > m_search_space[j].getMax()) t[j] = (random ? *random : m_random).rand(m_search_space[j].getMin(), m_search_space[j].getMax());
 
-        if (t.hasVelocity()) t.setVelocity(j, -t.getVelocity(j));
-      }
+  } else if (m_oob_sol == RBC) { // Reflective Boundary Condition (RBC)
+
+    if (c[j] < m_search_space[j].getMin()) t[j] = 2 * m_search_space[j].getMin() - c[j];
+    if (c[j] > m_search_space[j].getMax()) t[j] = 2 * m_search_space[j].getMax() - c[j];
 
+    if (c[j] < m_search_space[j].getMin() || c[j] > m_search_space[j].getMax()) {
+      t[j] = random ? random->rand(m_search_space[j].getMin(), m_search_space[j].getMax()) : m_search_space.getRandom(j);
     }
+
+    if (t.hasVelocity()) t.setVelocity(j, -t.getVelocity(j));
   }
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
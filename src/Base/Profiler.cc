@@ -0,0 +1,118 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <Base/Profiler.h>
+
+using namespace EmiROOT;
+
+thread_local ScopedTimer* ScopedTimer::s_current = nullptr;
+
+Profiler::Profiler() :
+m_last_evaluations(0) {
+  for (std::size_t i = 0; i < N_PHASES; ++i) {
+    m_time[i]        = 0;
+    m_calls[i]       = 0;
+    m_thread_time[i] = 0;
+  }
+  m_thread = std::this_thread::get_id();
+  m_start = m_stop = m_last_iteration = Clock::now();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Profiler::start(std::size_t t_iterations) {
+  for (std::size_t i = 0; i < N_PHASES; ++i) {
+    m_time[i]        = 0;
+    m_calls[i]       = 0;
+    m_thread_time[i] = 0;
+  }
+  m_thread = std::this_thread::get_id();
+  m_iteration_times.clear();
+  m_iteration_evaluations.clear();
+#ifdef EMIROOT_PROFILING
+  m_iteration_times.reserve(t_iterations);
+  m_iteration_evaluations.reserve(t_iterations);
+#else
+  (void) t_iterations;
+#endif
+  m_last_evaluations = 0;
+  m_start = m_stop = m_last_iteration = Clock::now();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Profiler::stop() {
+  m_stop = Clock::now();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void Profiler::endIteration(std::size_t t) {
+  Clock::time_point now = Clock::now();
+  m_iteration_times.push_back(std::chrono::duration<double>(now - m_last_iteration).count());
+  m_iteration_evaluations.push_back(t - m_last_evaluations);
+  m_last_iteration   = now;
+  m_last_evaluations = t;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+PerformanceReport Profiler::getReport() const {
+  PerformanceReport report;
+#ifdef EMIROOT_PROFILING
+  report.enabled = true;
+#else
+  report.enabled = false;
+#endif
+  report.total_time      = std::chrono::duration<double>(m_stop - m_start).count();
+  report.objective_time  = 1.e-9*m_time[OBJECTIVE].load();
+  report.constraint_time = 1.e-9*m_time[CONSTRAINTS].load();
+  // The phases of the calling thread do not overlap, so removing them
+  // from the wall time leaves the time of the framework, including the
+  // wait for the other threads; the CPU time of the objective function
+  // summed over several threads can instead exceed the wall time
+  report.framework_time  = report.enabled ? report.total_time - 1.e-9*(m_thread_time[OBJECTIVE] + m_thread_time[CONSTRAINTS]) : 0.;
+  report.evaluations     = m_last_evaluations;
+
+  if (report.enabled) {
+    for (std::size_t i = 0; i < N_PHASES; ++i) {
+      report.phases.push_back({getPhaseName(Phase(i)), 1.e-9*m_time[i].load(), m_calls[i].load()});
+    }
+  }
+  report.iteration_times       = m_iteration_times;
+  report.iteration_evaluations = m_iteration_evaluations;
+  return report;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+const char* Profiler::getPhaseName(Phase t) {
+  switch (t) {
+    case INITIALIZATION: return "initialization";
+    case PENALTY:        return "penalty";
+    case MOVE:           return "move";
+    case BOUNDARY:       return "boundary";
+    case EVALUATION:     return "evaluation";
+    case OBJECTIVE:      return "objective";
+    case CONSTRAINTS:    return "constraints";
+    case SORT:           return "sort";
+    case HISTORY:        return "history";
+    default:             return "";
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
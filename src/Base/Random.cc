@@ -17,6 +17,7 @@
 
 
 #include <Base/Random.h>
+#include <string.h>
 
 using std::chrono::duration_cast;
 using std::chrono::milliseconds;
@@ -54,6 +55,28 @@ std::vector<double> Random::randVector(std::size_t n, double t_min, double t_max
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
+void Random::fill(double* t, std::size_t n) {
+  // splitmix64 hashes a counter: the i-th number is the hash of the
+  // seed advanced i times
+  const uint64_t gamma = 0x9e3779b97f4a7c15;
+  const uint64_t seed = m_seed;
+  for (std::size_t i = 0; i < n; ++i) {
+    uint64_t z = seed + (i + 1)*gamma;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+    z = z ^ (z >> 31);
+
+    // same conversion as toDouble
+    uint64_t bits = UINT64_C(0x3FF) << 52 | z >> 12;
+    double d;
+    memcpy(&d, &bits, sizeof(d));
+    t[i] = d - 1.0;
+  }
+  m_seed = seed + n*gamma;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
 uint64_t Random::randUInt(uint64_t t_min, uint64_t t_max) {
   uint64_t x, r;
   do {
@@ -79,6 +102,25 @@ double Random::norm(double t_mean, double t_sigma) {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
+void Random::fillNorm(double* t, std::size_t n) {
+  const std::size_t block = 32;
+  double u[2*block];
+  double pi = 3.14159265358979323846;
+  for (std::size_t i = 0; i < n; i += block) {
+    std::size_t m = std::min(block, n - i);
+    fill(u, 2*m);
+    for (std::size_t k = 0; k < m; ++k) t[i + k] = sqrt(-2*log(u[2*k]))*cos(2*pi*u[2*k + 1]);
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+Random Random::split() {
+  return Random(next());
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
 uint64_t Random::next() {
   uint64_t z = (m_seed += 0x9e3779b97f4a7c15);
   z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
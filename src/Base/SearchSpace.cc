@@ -17,15 +17,20 @@
 
 
 #include <Base/SearchSpace.h>
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 
 using namespace EmiROOT;
 
-SearchSpace::SearchSpace() : m_par(0), m_constr_init_pop(false) {}
+SearchSpace::SearchSpace() : m_par(0), m_constr_init_pop(false), m_max_trials(10000), m_design_left(0),
+                             m_n_generated(0), m_n_rejected(0), m_n_infeasible(0) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-SearchSpace::SearchSpace(int n) : m_par(n), m_gen_point(n), m_constr_init_pop(false) {}
+SearchSpace::SearchSpace(int n) : m_par(n), m_gen_point(n), m_constr_init_pop(false), m_max_trials(10000), m_design_left(0),
+                                  m_n_generated(0), m_n_rejected(0), m_n_infeasible(0) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
@@ -71,26 +76,44 @@ void SearchSpace::setCostrInitPop(bool t) {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-bool SearchSpace::ckeckConstraint() {
-  Function g;
+void SearchSpace::setCostrInitPopMaxTrials(std::size_t t) {
+  m_max_trials = std::max<std::size_t>(t, 1);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void SearchSpace::setInitialDesign(InitialDesignType t) {
+  m_design.setType(t);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void SearchSpace::startInitialDesign(std::size_t n) {
+  m_design.start(n, m_par.size(), m_random);
+  m_design_left = n;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+bool SearchSpace::ckeckConstraint(double& violation) {
   Inequality inequality;
   double tmp_d;
+  bool violated = false;
+  violation = 0.;
   for (size_t i = 0; i < m_constraints.size(); ++i) {
-    g = m_constraints[i].getFunction();
+    const Function& g = m_constraints[i].getFunction();
     inequality = m_constraints[i].getInequality();
     tmp_d = g(m_gen_point);
 
-    if (inequality == Inequality::L && tmp_d >= 0) {
-      return true;
-    } else if (inequality == Inequality::LEQ && tmp_d > 0) {
-      return true;
-    } else if (inequality == Inequality::GEQ && tmp_d < 0) {
-      return true;
-    } else if (inequality == Inequality::G && tmp_d <= 0) {
-      return true;
+    if ((inequality == Inequality::L && tmp_d >= 0) ||
+        (inequality == Inequality::LEQ && tmp_d > 0) ||
+        (inequality == Inequality::GEQ && tmp_d < 0) ||
+        (inequality == Inequality::G && tmp_d <= 0)) {
+      violated = true;
+      violation += fabs(tmp_d);
     }
   }
-  return false;
+  return violated;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
@@ -102,15 +125,43 @@ double SearchSpace::getRandom(std::size_t i) {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-Point SearchSpace::getRandom() {
-  for (std::size_t i = 0; i < m_gen_point.size(); ++i) m_gen_point[i] = getRandom(i);
+void SearchSpace::generatePoint() {
+  if (m_design_left > 0 && m_design.next(m_gen_point.data())) {
+    for (std::size_t i = 0; i < m_gen_point.size(); ++i) {
+      m_gen_point[i] = m_par[i].getMin() + m_gen_point[i]*(m_par[i].getMax() - m_par[i].getMin());
+    }
+  } else {
+    for (std::size_t i = 0; i < m_gen_point.size(); ++i) m_gen_point[i] = getRandom(i);
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
-  // in case of a constrained optimization, check is
-  // the solution violates any constraint
+
+const Point& SearchSpace::getRandom() {
+  // in case of a constrained optimization, generate until the point
+  // does not violate any constraint, for at most m_max_trials points,
+  // after which the point with the smallest violation is taken
+  generatePoint();
   if (m_constr_init_pop) {
-    if (ckeckConstraint()) return getRandom();
+    double violation, best_violation = std::numeric_limits<double>::max();
+    for (std::size_t trial = 1; ckeckConstraint(violation); ++trial) {
+      m_n_rejected++;
+      if (violation < best_violation) {
+        best_violation = violation;
+        m_best_point = m_gen_point;
+      }
+      if (trial == m_max_trials) {
+        m_gen_point = m_best_point;
+        m_n_infeasible++;
+        break;
+      }
+      generatePoint();
+    }
   }
 
+  // the design ends after the requested number of points
+  if (m_design_left > 0 && --m_design_left == 0) m_design.stop();
+  m_n_generated++;
   return m_gen_point;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -0,0 +1,110 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <Base/Selection.h>
+#include <algorithm>
+
+using namespace EmiROOT;
+
+RouletteWheel::RouletteWheel() {}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void RouletteWheel::set(const std::vector<double>& weights) {
+  std::size_t n = weights.size();
+  m_cumulative.resize(n);
+  if (n == 0) return;
+
+  double total = 0.;
+  for (double w : weights) total += w;
+
+  double sum = 0.;
+  for (std::size_t i = 0; i < n; ++i) {
+    sum += total > 0. ? weights[i] / total : 1. / n;
+    m_cumulative[i] = sum;
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::size_t RouletteWheel::select(double u) const {
+  // First entry whose cumulative probability reaches u. Rounding can leave
+  // the last cumulative probability slightly below 1.
+  std::size_t i = std::lower_bound(m_cumulative.begin(), m_cumulative.end(), u) - m_cumulative.begin();
+  return std::min(i, m_cumulative.size() - 1);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+AliasTable::AliasTable() {}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void AliasTable::set(const std::vector<double>& weights) {
+  std::size_t n = weights.size();
+  m_prob.resize(n);
+  m_alias.resize(n);
+  m_small.clear();
+  m_large.clear();
+  m_small.reserve(n);
+  m_large.reserve(n);
+  if (n == 0) return;
+
+  double total = 0.;
+  for (double w : weights) total += w;
+
+  // Scale the probabilities so that the average bin is full (1)
+  for (std::size_t i = 0; i < n; ++i) {
+    m_prob[i]  = total > 0. ? n * weights[i] / total : 1.;
+    m_alias[i] = i;
+    if (m_prob[i] < 1.) {
+      m_small.push_back(i);
+    } else {
+      m_large.push_back(i);
+    }
+  }
+
+  // Fill every under-full bin with the excess of an over-full one
+  while (!m_small.empty() && !m_large.empty()) {
+    std::size_t s = m_small.back();
+    std::size_t l = m_large.back();
+    m_small.pop_back();
+    m_alias[s] = l;
+    m_prob[l] -= 1. - m_prob[s];
+    if (m_prob[l] < 1.) {
+      m_large.pop_back();
+      m_small.push_back(l);
+    }
+  }
+
+  // What is left is full up to rounding errors
+  for (std::size_t i : m_small) m_prob[i] = 1.;
+  for (std::size_t i : m_large) m_prob[i] = 1.;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::size_t AliasTable::select(double u) const {
+  // The integer part of u*n selects the bin, the fractional part
+  // decides between the entry of the bin and its alias
+  std::size_t n = m_prob.size();
+  double x = u * n;
+  std::size_t i = std::min((std::size_t) x, n - 1);
+  return x - i < m_prob[i] ? i : m_alias[i];
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
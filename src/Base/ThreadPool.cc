@@ -0,0 +1,91 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <Base/ThreadPool.h>
+
+using namespace EmiROOT;
+
+ThreadPool::ThreadPool(std::size_t t_threads) :
+m_generation(0),
+m_busy(0),
+m_stop(false),
+m_task(nullptr),
+m_context(nullptr),
+m_n(0),
+m_next(0) {
+  for (std::size_t i = 1; i < t_threads; ++i) m_workers.emplace_back(&ThreadPool::workerLoop, this);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stop = true;
+  }
+  m_wake.notify_all();
+  for (std::thread& t : m_workers) t.join();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void ThreadPool::run(std::size_t n, Task t_task, void* t_context) {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_task    = t_task;
+    m_context = t_context;
+    m_n       = n;
+    m_next    = 0;
+    m_busy    = m_workers.size();
+    ++m_generation;
+  }
+  m_wake.notify_all();
+
+  work();
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done.wait(lock, [this] {return m_busy == 0;});
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void ThreadPool::work() {
+  for (std::size_t i = m_next++; i < m_n; i = m_next++) m_task(m_context, i);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void ThreadPool::workerLoop() {
+  std::size_t generation = 0;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_wake.wait(lock, [&] {return m_stop || m_generation != generation;});
+      if (m_stop) return;
+      generation = m_generation;
+    }
+
+    work();
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (--m_busy == 0) m_done.notify_one();
+    }
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -0,0 +1,317 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <CC/CCPopulation.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <limits>
+
+using namespace EmiROOT;
+
+namespace {
+
+  // Point evaluated by the objective function of a group, one per thread.
+  // Only the coordinates of the group change from one call to the next,
+  // so the context vector is copied once per run of the algorithm of a
+  // group on each thread, which the run identifier tells.
+  struct GroupPoint {
+    std::size_t run = 0;
+    Point       x;
+  };
+
+  thread_local GroupPoint t_point;
+
+  // Identifier of the runs, unique in the process
+  std::atomic<std::size_t> s_runs(0);
+
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+CCPopulation::CCPopulation(Function func) : PopulationBase(func) {}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CCPopulation::init() {
+  std::size_t d = m_search_space.getNumberOfParameters();
+  if (!m_config.getOptimizer()) {
+    std::cout << "The optimizer of the groups of CC is not set.\n";
+    abort();
+  }
+
+  // The points of the groups are never regenerated: the constraints are
+  // included in the cost with the penalty method
+  if (!m_constraints.empty() && m_constrained_method != "BARRIER") m_constrained_method = "PENALTY";
+
+  switch (m_oob_sol) {
+    case PBC: m_oob = "PBC"; break;
+    case BAB: m_oob = "BAB"; break;
+    case DIS: m_oob = "DIS"; break;
+    default:  m_oob = "RBC"; break;
+  }
+
+  // The context vector is the only individual
+  m_individuals.assign(1, Individual(d));
+  if (m_initial_population.size() > 0) {
+    m_individuals[0].setPosition(m_initial_population[0]);
+  } else {
+    if (!m_silent) std::cout << "Generating the initial context vector...\n";
+    m_individuals[0].setPosition(m_search_space.getRandom());
+  }
+  m_merged = static_cast<const Individual&>(m_individuals[0]).getPosition();
+  m_groups.clear();
+
+  // Dummy assignment of the best individual. When the cost of
+  // the population is actually evaluated this is fixed.
+  m_best_solution = m_individuals[0];
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CCPopulation::splitGroups(const std::vector<std::size_t>& t) {
+  std::size_t size = m_config.getGroupSize();
+  for (std::size_t k = 0; k < t.size(); k += size) {
+    m_groups.push_back(std::vector<std::size_t>(t.begin() + k, t.begin() + std::min(k + size, t.size())));
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CCPopulation::makeGroups() {
+  std::size_t d = m_search_space.getNumberOfParameters();
+  m_order_par.resize(d);
+  for (std::size_t j = 0; j < d; ++j) m_order_par[j] = j;
+
+  m_groups.clear();
+  if (m_config.getGrouping() == DIFFERENTIAL_GROUPING) {
+    learnGroups();
+  } else {
+    splitGroups(m_order_par);
+  }
+  m_group_best.resize(m_groups.size());
+  m_group_cost.resize(m_groups.size());
+  m_budgets.resize(m_groups.size());
+  m_seeds.resize(m_groups.size());
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CCPopulation::learnGroups() {
+  // Two parameters i and j interact if the change of the cost when x_i
+  // goes from its lower to its upper boundary depends on x_j. With all
+  // the parameters at their lower boundary, the cost of the points in
+  // which only x_i, or only x_j, is moved is shared by all the pairs, so
+  // that the test of all the pairs takes 1 + d + d(d-1)/2 evaluations.
+  // The groups are the connected components of the interactions, which
+  // keeps together parameters that interact through others.
+  std::size_t d = m_search_space.getNumberOfParameters();
+  double threshold = m_config.getGroupingThreshold();
+  if (1 + d + d*(d - 1)/2 > getRemainingEvaluations()/2) {
+    if (!m_silent) std::cout << "The budget is too small for the differential grouping: using the static grouping.\n";
+    splitGroups(m_order_par);
+    return;
+  }
+
+  Point x(d);
+  for (std::size_t j = 0; j < d; ++j) x[j] = m_search_space[j].getMin();
+  double f0 = evaluateCost(x);
+
+  std::vector<double> f1(d);
+  for (std::size_t i = 0; i < d; ++i) {
+    x[i] = m_search_space[i].getMax();
+    f1[i] = evaluateCost(x);
+    x[i] = m_search_space[i].getMin();
+  }
+
+  // Union-find of the interacting parameters
+  std::vector<std::size_t> root(d);
+  for (std::size_t j = 0; j < d; ++j) root[j] = j;
+  auto find = [&root](std::size_t j) {
+    while (root[j] != j) j = root[j] = root[root[j]];
+    return j;
+  };
+
+  for (std::size_t i = 0; i < d; ++i) {
+    x[i] = m_search_space[i].getMax();
+    for (std::size_t j = i + 1; j < d; ++j) {
+      x[j] = m_search_space[j].getMax();
+      double delta = f0 - f1[i] - f1[j] + evaluateCost(x);
+      x[j] = m_search_space[j].getMin();
+      if (std::fabs(delta) > threshold) {
+        std::size_t ri = find(i), rj = find(j);
+        if (ri != rj) root[std::max(ri, rj)] = std::min(ri, rj);
+      }
+    }
+    x[i] = m_search_space[i].getMin();
+  }
+
+  // Components, in the order of their first parameter
+  std::vector<std::vector<std::size_t> > components;
+  std::vector<std::size_t> index(d);
+  std::size_t n_separable = 0;
+  for (std::size_t j = 0; j < d; ++j) {
+    std::size_t r = find(j);
+    if (r == j) {
+      index[j] = components.size();
+      components.emplace_back();
+    }
+    components[index[r]].push_back(j);
+  }
+
+  // The components are packed in groups of about the configured size, so
+  // that the separable parameters and the small components do not make
+  // groups too small to be optimized with their budget. The components
+  // larger than the size are groups on their own.
+  std::size_t size = m_config.getGroupSize();
+  for (const std::vector<std::size_t>& c : components) {
+    if (c.size() == 1) n_separable++;
+    if (m_groups.empty() || m_groups.back().size() + c.size() > size) m_groups.emplace_back();
+    m_groups.back().insert(m_groups.back().end(), c.begin(), c.end());
+  }
+
+  if (!m_silent) {
+    std::cout << "Differential grouping: " << components.size() - n_separable << " components of interacting parameters, "
+              << n_separable << " separable parameters, " << m_groups.size() << " groups\n";
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CCPopulation::insertGroup(std::size_t g, Point& t) const {
+  const std::vector<std::size_t>& group = m_groups[g];
+  for (std::size_t k = 0; k < group.size(); ++k) t[group[k]] = m_group_best[g][k];
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CCPopulation::optimizeGroup(std::size_t g, std::size_t budget, uint64_t seed, std::size_t n_threads, const Point& context) {
+  const std::vector<std::size_t>& group = m_groups[g];
+  std::size_t run = ++s_runs;
+
+  // Objective function of the group, with the other parameters fixed
+  Function f = [this, &group, &context, run](const Point& y) {
+    GroupPoint& p = t_point;
+    if (p.run != run) {
+      p.x = context;
+      p.run = run;
+    }
+    for (std::size_t k = 0; k < group.size(); ++k) p.x[group[k]] = y[k];
+    return evaluateCost(p.x);
+  };
+
+  // The run starts from the values of the context vector, so that the
+  // cost of the group can only improve from one cycle to the next
+  Parameters parameters;
+  PopulationState start(1, Point(group.size()));
+  for (std::size_t k = 0; k < group.size(); ++k) {
+    parameters.push_back(m_search_space[group[k]]);
+    start[0][k] = context[group[k]];
+  }
+
+  std::unique_ptr<Algorithm> algo = m_config.getOptimizer()(f, budget);
+  algo->setParameters(parameters);
+  algo->setInitialPopulation(start);
+  algo->setSilent(true);
+  algo->setOOB(m_oob);
+  algo->setNThreads(n_threads);
+  algo->setSeed(seed);
+  algo->minimize();
+
+  OptimizationResults results = algo->getResults();
+  m_group_cost[g] = results.best_cost;
+  m_group_best[g] = results.best_parameters;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CCPopulation::optimizeGroups() {
+  std::size_t d = m_search_space.getNumberOfParameters();
+  std::size_t n_groups = m_groups.size();
+  Individual& context = m_individuals[0];
+
+  // Random groups, drawn again at each cycle
+  if (m_config.getGrouping() == RANDOM_GROUPING) {
+    for (std::size_t j = d - 1; j > 0; --j) std::swap(m_order_par[j], m_order_par[m_random.randUInt(0, j + 1)]);
+    m_groups.clear();
+    splitGroups(m_order_par);
+  }
+
+  // Budgets and seeds are drawn beforehand, so that the result does not
+  // depend on the order in which the groups are optimized
+  std::size_t remaining = getRemainingEvaluations();
+  for (std::size_t g = 0; g < n_groups; ++g) {
+    m_budgets[g] = std::min(remaining, m_config.getGroupBudget()*m_groups[g].size());
+    remaining -= m_budgets[g];
+    m_seeds[g] = m_random.randUInt(0, std::numeric_limits<uint64_t>::max());
+    m_group_cost[g] = std::numeric_limits<double>::max();
+  }
+
+  if (!m_config.isConcurrentGroups()) {
+
+    // Each group is optimized against the context vector updated by the
+    // previous ones, using the threads for its own algorithm
+    for (std::size_t g = 0; g < n_groups && m_budgets[g] > 0; ++g) {
+      optimizeGroup(g, m_budgets[g], m_seeds[g], getNThreads(), static_cast<const Individual&>(context).getPosition());
+      if (m_group_cost[g] < context.getCost()) {
+        insertGroup(g, context.getPosition());
+        context.setCost(m_group_cost[g]);
+        // the violation of the constraints is only known evaluating the point
+        if (!m_constraints.empty() && getRemainingEvaluations() > 0) evaluate(context);
+        track(context);
+      }
+    }
+
+  } else {
+
+    // All the groups are optimized against the same context vector,
+    // concurrently if possible
+    const Point& snapshot = static_cast<const Individual&>(context).getPosition();
+    forEach(n_groups, [this, &snapshot](std::size_t g) {
+      if (m_budgets[g] > 0) optimizeGroup(g, m_budgets[g], m_seeds[g], 1, snapshot);
+    });
+
+    // The results of the groups improving the context vector are merged;
+    // since the groups may interact, the best group alone is taken if
+    // the merged point is worse
+    std::size_t best = n_groups, n_improved = 0;
+    m_merged = snapshot;
+    for (std::size_t g = 0; g < n_groups; ++g) {
+      if (m_group_cost[g] >= context.getCost()) continue;
+      insertGroup(g, m_merged);
+      n_improved++;
+      if (best == n_groups || m_group_cost[g] < m_group_cost[best]) best = g;
+    }
+    if (best == n_groups) return;
+
+    double violation = 0.;
+    double cost = m_group_cost[best];
+    if (n_improved > 1 && getRemainingEvaluations() > 0) cost = std::min(cost, evaluateCost(m_merged, violation));
+    if (cost < m_group_cost[best]) {
+      context.setPosition(m_merged);
+      context.setCost(cost, violation);
+    } else {
+      insertGroup(best, context.getPosition());
+      context.setCost(m_group_cost[best]);
+      if (!m_constraints.empty() && getRemainingEvaluations() > 0) evaluate(context);
+    }
+    track(context);
+
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
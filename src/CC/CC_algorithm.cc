@@ -0,0 +1,42 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <CC/CC_algorithm.h>
+
+using namespace EmiROOT;
+
+template class EmiROOT::AlgorithmBase<CC_algorithm, CCPopulation, CCConfig>;
+
+CC_algorithm::CC_algorithm(const Function& obj_function, const CCConfig& config) :
+AlgorithmBase<CC_algorithm, CCPopulation, CCConfig>(obj_function, config) {}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void CC_algorithm::initialize() {
+  // Evaluate the cost of the context vector
+  m_population.evaluate();
+
+  // Decompose the parameters
+  m_population.makeGroups();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void CC_algorithm::step() {
+  // One cycle over the groups
+  m_population.optimizeGroups();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
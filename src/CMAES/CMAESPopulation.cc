@@ -0,0 +1,483 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <CMAES/CMAESPopulation.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace EmiROOT;
+
+namespace {
+
+  // Side of the square blocks of the covariance matrix in the rank-mu
+  // update, small enough for a block and the matching slices of the
+  // selected steps to stay in the L1 cache
+  const std::size_t kBlock = 32;
+
+  // Tolerances of the termination criteria of a run
+  const double kTolFun       = 1.e-12;
+  const double kTolX         = 1.e-12;
+  const double kMaxCondition = 1.e14;
+
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+CMAESPopulation::CMAESPopulation(Function func) : PopulationBase(func) {
+  m_lambda = 0;
+  m_lambda0 = 0;
+  m_mu = 0;
+  m_mueff = 0.;
+  m_cs = 0.;
+  m_ds = 0.;
+  m_cc = 0.;
+  m_c1 = 0.;
+  m_cmu = 0.;
+  m_chi_n = 0.;
+  m_eigen_gap = 1;
+  m_sigma = 0.;
+  m_sigma0 = 0.;
+  m_generation = 0;
+  m_eigen_generation = 0;
+  m_n_sampled = 0;
+  m_converged = false;
+  m_n_history = 0;
+  m_n_restarts = 0;
+  m_n_large = 0;
+  m_evals_large = 0;
+  m_evals_small = 0;
+  m_run_start = 0;
+  m_small_regime = false;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CMAESPopulation::init() {
+  std::size_t d = m_search_space.getNumberOfParameters();
+
+  // The default population size grows with the logarithm of the dimension
+  m_lambda0 = m_config.getPopulationSize();
+  if (m_lambda0 == 0) m_lambda0 = 4 + (std::size_t) std::floor(3.*std::log((double) d));
+  m_lambda0 = std::max(m_lambda0, (std::size_t) 2);
+
+  m_lower.resize(d);
+  m_range.resize(d);
+  for (std::size_t j = 0; j < d; ++j) {
+    m_lower[j] = m_search_space[j].getMin();
+    m_range[j] = m_search_space[j].getMax() - m_search_space[j].getMin();
+  }
+  m_mean.assign(d, 0.5);
+
+  m_individual_random.clear();
+  m_n_restarts = 0;
+  m_n_large = 0;
+  m_evals_large = 0;
+  m_evals_small = 0;
+  m_small_regime = false;
+  resetDistribution(m_lambda0, m_config.getSigma());
+
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
+
+  if (n_loaded < m_individuals.size()) {
+
+    // Generate randomly the position of the other individuals
+    if (!m_silent) std::cout << "Generating the initial population...\n";
+    for (std::size_t i = n_loaded; i < m_individuals.size(); ++i) {
+      m_individuals[i].setPosition(m_search_space.getRandom());
+    }
+
+  }
+
+  // Dummy assignment of the best individual. When the cost of
+  // the population is actually evaluated this is fixed.
+  m_best_solution = m_individuals[0];
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CMAESPopulation::resetDistribution(std::size_t lambda, double sigma) {
+  std::size_t d = m_search_space.getNumberOfParameters();
+  double n = d;
+
+  // Strategy parameters, with the default values of Hansen's tutorial
+  m_lambda = lambda;
+  m_mu = m_lambda/2;
+  m_weights.resize(m_mu);
+  double sum = 0.;
+  for (std::size_t i = 0; i < m_mu; ++i) {
+    m_weights[i] = std::log(m_mu + 0.5) - std::log(i + 1.);
+    sum += m_weights[i];
+  }
+  double sum2 = 0.;
+  for (std::size_t i = 0; i < m_mu; ++i) {
+    m_weights[i] /= sum;
+    sum2 += m_weights[i]*m_weights[i];
+  }
+  m_mueff = 1./sum2;
+  m_cs    = (m_mueff + 2.)/(n + m_mueff + 5.);
+  m_ds    = 1. + 2.*std::max(0., std::sqrt((m_mueff - 1.)/(n + 1.)) - 1.) + m_cs;
+  m_cc    = (4. + m_mueff/n)/(n + 4. + 2.*m_mueff/n);
+  m_c1    = 2./((n + 1.3)*(n + 1.3) + m_mueff);
+  m_cmu   = std::min(1. - m_c1, 2.*(m_mueff - 2. + 1./m_mueff)/((n + 2.)*(n + 2.) + m_mueff));
+  m_chi_n = std::sqrt(n)*(1. - 1./(4.*n) + 1./(21.*n*n));
+
+  // The covariance matrix changes little from one generation to the
+  // next: it is decomposed every O(d) generations, which makes the cost
+  // of the decomposition per sample O(d^2) like the sampling itself
+  m_eigen_gap = std::max((std::size_t) 1, (std::size_t) (1./(10.*n*(m_c1 + m_cmu))));
+
+  // Buffers of the population, which only grow with the restarts
+  if (m_individuals.size() != m_lambda) m_individuals.resize(m_lambda, Individual(d));
+  while (m_individual_random.size() < m_lambda) m_individual_random.push_back(m_random.split());
+  m_noise.resize(m_lambda*d);
+  m_steps.resize(m_lambda*d);
+  m_weighted.resize(m_mu*d);
+  m_yw.resize(d);
+  m_tmp.resize(d);
+  m_work.resize(d*d);
+
+  // Identity covariance matrix and null paths
+  m_C.assign(d*d, 0.);
+  m_B.assign(d*d, 0.);
+  m_BD.assign(d*d, 0.);
+  for (std::size_t j = 0; j < d; ++j) m_C[j*d + j] = m_B[j*d + j] = m_BD[j*d + j] = 1.;
+  m_D.assign(d, 1.);
+  m_ps.assign(d, 0.);
+  m_pc.assign(d, 0.);
+
+  m_sigma  = sigma;
+  m_sigma0 = sigma;
+  m_generation = 0;
+  m_eigen_generation = 0;
+  m_n_sampled = 0;
+  m_converged = false;
+  m_history.resize(10 + (std::size_t) std::ceil(30.*n/m_lambda));
+  m_n_history = 0;
+  m_run_start = getNEvaluations();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CMAESPopulation::initDistribution() {
+  std::size_t d = m_search_space.getNumberOfParameters();
+
+  // weighted mean of the best individuals, in the unit cube
+  {
+    EMIROOT_PROFILE(m_profiler, SORT);
+    m_order.set(m_individuals);
+    m_order.partialSort(m_mu);
+  }
+  std::fill(m_mean.begin(), m_mean.end(), 0.);
+  for (std::size_t r = 0; r < m_mu; ++r) {
+    const Point& x = static_cast<const Individual&>(m_individuals[m_order[r]]).getPosition();
+    for (std::size_t j = 0; j < d; ++j) {
+      if (m_range[j] > 0.) m_mean[j] += m_weights[r]*(x[j] - m_lower[j])/m_range[j];
+    }
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CMAESPopulation::sampleGeneration() {
+  std::size_t d = m_search_space.getNumberOfParameters();
+  m_n_sampled = std::min(m_lambda, getRemainingEvaluations());
+
+  // Maximum Mahalanobis norm of the step of a repaired individual
+  double max_norm = std::sqrt((double) d) + 2.*d/(d + 2.);
+
+  auto sample = [this, d, max_norm](std::size_t i) {
+    Individual& ind = m_individuals[i];
+    Random& random = m_individual_random[i];
+    double* z = &m_noise[i*d];
+    double* y = &m_steps[i*d];
+
+    // y = B D z, with z standard normal
+    random.fillNorm(z, d);
+    for (std::size_t j = 0; j < d; ++j) {
+      const double* bd = &m_BD[j*d];
+      double s = 0.;
+      for (std::size_t k = 0; k < d; ++k) s += bd[k]*z[k];
+      y[j] = s;
+    }
+
+    // the sampled point is also kept in z, to detect a repair
+    Point& x = ind.getPosition();
+    for (std::size_t j = 0; j < d; ++j) z[j] = x[j] = m_lower[j] + m_range[j]*(m_mean[j] + m_sigma*y[j]);
+
+    // boundary check
+    checkBoundary(ind, random);
+
+    evaluateInto(ind);
+
+    // If the point was repaired the distribution is updated with the
+    // step actually taken, whose Mahalanobis norm is limited so that a
+    // far repair does not blow up the covariance matrix
+    const Point& xr = static_cast<const Individual&>(ind).getPosition();
+    bool repaired = false;
+    for (std::size_t j = 0; j < d; ++j) {
+      if (xr[j] != z[j]) repaired = true;
+    }
+    if (!repaired) return;
+
+    for (std::size_t j = 0; j < d; ++j) {
+      y[j] = m_range[j] > 0. ? ((xr[j] - m_lower[j])/m_range[j] - m_mean[j])/m_sigma : 0.;
+    }
+    // z = D^-1 B^T y
+    std::fill(z, z + d, 0.);
+    for (std::size_t j = 0; j < d; ++j) {
+      const double* b = &m_B[j*d];
+      for (std::size_t k = 0; k < d; ++k) z[k] += b[k]*y[j];
+    }
+    double norm = 0.;
+    for (std::size_t k = 0; k < d; ++k) norm += z[k]*z[k]/(m_D[k]*m_D[k]);
+    norm = std::sqrt(norm);
+    if (norm > max_norm) {
+      for (std::size_t j = 0; j < d; ++j) y[j] *= max_norm/norm;
+    }
+  };
+
+  forEach(m_n_sampled, sample);
+
+  for (std::size_t i = 0; i < m_n_sampled; ++i) track(m_individuals[i]);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CMAESPopulation::updateDistribution() {
+  // a generation cut by the budget cannot be ranked
+  if (m_n_sampled < m_lambda) return;
+
+  std::size_t d = m_search_space.getNumberOfParameters();
+  double n = d;
+
+  {
+    EMIROOT_PROFILE(m_profiler, SORT);
+    m_order.set(m_individuals);
+    m_order.partialSort(m_mu);
+  }
+
+  // Weighted mean of the selected steps. The steps, scaled by the square
+  // root of their weight, are also copied in contiguous rows for the
+  // rank-mu update.
+  std::fill(m_yw.begin(), m_yw.end(), 0.);
+  for (std::size_t r = 0; r < m_mu; ++r) {
+    const double* y = &m_steps[m_order[r]*d];
+    double* yw = &m_weighted[r*d];
+    double w = m_weights[r];
+    double sw = std::sqrt(w);
+    for (std::size_t j = 0; j < d; ++j) {
+      m_yw[j] += w*y[j];
+      yw[j] = sw*y[j];
+    }
+  }
+  for (std::size_t j = 0; j < d; ++j) m_mean[j] += m_sigma*m_yw[j];
+
+  // Evolution path of the step size, with C^-1/2 y_w = B D^-1 B^T y_w
+  std::fill(m_tmp.begin(), m_tmp.end(), 0.);
+  for (std::size_t j = 0; j < d; ++j) {
+    const double* b = &m_B[j*d];
+    for (std::size_t k = 0; k < d; ++k) m_tmp[k] += b[k]*m_yw[j];
+  }
+  for (std::size_t k = 0; k < d; ++k) m_tmp[k] /= m_D[k];
+  double cs = std::sqrt(m_cs*(2. - m_cs)*m_mueff);
+  double ps_norm = 0.;
+  for (std::size_t j = 0; j < d; ++j) {
+    const double* b = &m_B[j*d];
+    double s = 0.;
+    for (std::size_t k = 0; k < d; ++k) s += b[k]*m_tmp[k];
+    m_ps[j] = (1. - m_cs)*m_ps[j] + cs*s;
+    ps_norm += m_ps[j]*m_ps[j];
+  }
+  ps_norm = std::sqrt(ps_norm);
+
+  // Evolution path of the covariance matrix, stalled when the step size
+  // path is long to avoid a fast increase of the axes of C
+  m_generation++;
+  double h_sigma = ps_norm/std::sqrt(1. - std::pow(1. - m_cs, 2.*m_generation)) < (1.4 + 2./(n + 1.))*m_chi_n ? 1. : 0.;
+  double cc = h_sigma*std::sqrt(m_cc*(2. - m_cc)*m_mueff);
+  for (std::size_t j = 0; j < d; ++j) m_pc[j] = (1. - m_cc)*m_pc[j] + cc*m_yw[j];
+
+  // Rank-one and rank-mu updates of the upper triangle of C. The matrix
+  // is walked by square blocks and the selected steps are accumulated
+  // into each block while it is in the cache.
+  double decay = 1. - m_c1 - m_cmu + (1. - h_sigma)*m_c1*m_cc*(2. - m_cc);
+  for (std::size_t jb = 0; jb < d; jb += kBlock) {
+    std::size_t j_end = std::min(jb + kBlock, d);
+    for (std::size_t kb = jb; kb < d; kb += kBlock) {
+      std::size_t k_end = std::min(kb + kBlock, d);
+      for (std::size_t j = jb; j < j_end; ++j) {
+        double* c = &m_C[j*d];
+        std::size_t k0 = std::max(kb, j);
+        double pcj = m_c1*m_pc[j];
+        for (std::size_t k = k0; k < k_end; ++k) c[k] = decay*c[k] + pcj*m_pc[k];
+        for (std::size_t r = 0; r < m_mu; ++r) {
+          const double* yw = &m_weighted[r*d];
+          double a = m_cmu*yw[j];
+          for (std::size_t k = k0; k < k_end; ++k) c[k] += a*yw[k];
+        }
+      }
+    }
+  }
+
+  // Step size adaptation
+  m_sigma *= std::exp(std::min(1., (m_cs/m_ds)*(ps_norm/m_chi_n - 1.)));
+
+  // Lazy eigendecomposition
+  if (m_generation - m_eigen_generation >= m_eigen_gap) decompose();
+
+  double worst = m_order.getCost(0);
+  for (std::size_t i = 0; i < m_lambda; ++i) worst = std::max(worst, m_individuals[i].getCost());
+  checkConvergence(m_order.getCost(0), worst);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CMAESPopulation::decompose() {
+  std::size_t d = m_search_space.getNumberOfParameters();
+  m_eigen_generation = m_generation;
+
+  // Symmetric work copy of C and identity eigenvectors
+  double* a = m_work.data();
+  double* v = m_B.data();
+  for (std::size_t j = 0; j < d; ++j) {
+    for (std::size_t k = j; k < d; ++k) a[j*d + k] = a[k*d + j] = m_C[j*d + k];
+    for (std::size_t k = 0; k < d; ++k) v[j*d + k] = j == k ? 1. : 0.;
+  }
+
+  // Cyclic Jacobi sweeps, until the off-diagonal elements are negligible
+  for (std::size_t sweep = 0; sweep < 50; ++sweep) {
+    double off = 0., diag = 0.;
+    for (std::size_t p = 0; p < d; ++p) {
+      diag += a[p*d + p]*a[p*d + p];
+      for (std::size_t q = p + 1; q < d; ++q) off += a[p*d + q]*a[p*d + q];
+    }
+    if (off <= 1.e-30*diag) break;
+
+    for (std::size_t p = 0; p < d; ++p) {
+      for (std::size_t q = p + 1; q < d; ++q) {
+        double apq = a[p*d + q];
+        if (apq == 0.) continue;
+
+        // rotation annihilating a[p][q]
+        double theta = (a[q*d + q] - a[p*d + p])/(2.*apq);
+        double t = (theta >= 0. ? 1. : -1.)/(std::fabs(theta) + std::sqrt(theta*theta + 1.));
+        double c = 1./std::sqrt(t*t + 1.);
+        double s = t*c;
+
+        for (std::size_t k = 0; k < d; ++k) {
+          double akp = a[k*d + p];
+          double akq = a[k*d + q];
+          a[k*d + p] = c*akp - s*akq;
+          a[k*d + q] = s*akp + c*akq;
+        }
+        for (std::size_t k = 0; k < d; ++k) {
+          double apk = a[p*d + k];
+          double aqk = a[q*d + k];
+          a[p*d + k] = c*apk - s*aqk;
+          a[q*d + k] = s*apk + c*aqk;
+        }
+        for (std::size_t k = 0; k < d; ++k) {
+          double vkp = v[k*d + p];
+          double vkq = v[k*d + q];
+          v[k*d + p] = c*vkp - s*vkq;
+          v[k*d + q] = s*vkp + c*vkq;
+        }
+      }
+    }
+  }
+
+  // The eigenvalues are clamped to keep the matrix positive definite
+  double max_ev = 0.;
+  for (std::size_t k = 0; k < d; ++k) max_ev = std::max(max_ev, a[k*d + k]);
+  double min_ev = max_ev;
+  for (std::size_t k = 0; k < d; ++k) {
+    double ev = std::max(a[k*d + k], 1.e-20*max_ev);
+    min_ev = std::min(min_ev, ev);
+    m_D[k] = std::sqrt(ev);
+  }
+  for (std::size_t j = 0; j < d; ++j) {
+    for (std::size_t k = 0; k < d; ++k) m_BD[j*d + k] = m_B[j*d + k]*m_D[k];
+  }
+
+  if (!(max_ev > 0.) || max_ev > kMaxCondition*min_ev) m_converged = true;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CMAESPopulation::checkConvergence(double best, double worst) {
+  std::size_t d = m_search_space.getNumberOfParameters();
+
+  // Flat history of the best cost and flat generation
+  m_history[m_n_history % m_history.size()] = best;
+  m_n_history++;
+  if (m_n_history >= m_history.size()) {
+    auto range = std::minmax_element(m_history.begin(), m_history.end());
+    double tol = kTolFun*(1. + std::fabs(best));
+    if (*range.second - *range.first < tol && worst - best < tol) m_converged = true;
+  }
+
+  // Step size negligible along every coordinate, or too small to change the mean
+  bool small = true;
+  for (std::size_t j = 0; j < d; ++j) {
+    double sd = m_sigma*std::sqrt(m_C[j*d + j]);
+    if (m_sigma*std::max(std::fabs(m_pc[j]), std::sqrt(m_C[j*d + j])) >= kTolX*m_sigma0) small = false;
+    if (m_mean[j] + 0.2*sd == m_mean[j]) m_converged = true;
+  }
+  if (small || !std::isfinite(m_sigma)) m_converged = true;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void CMAESPopulation::restart() {
+  CMAESRestart strategy = m_config.getRestartStrategy();
+  if (strategy == NO_RESTART || m_n_restarts >= m_config.getNMaxRestarts()) return;
+
+  // Evaluations spent by the run that ends
+  std::size_t used = getNEvaluations() - m_run_start;
+  if (m_small_regime) {
+    m_evals_small += used;
+  } else {
+    m_evals_large += used;
+  }
+
+  std::size_t lambda;
+  double sigma = m_config.getSigma();
+  m_small_regime = strategy == BIPOP && m_n_large > 0 && m_evals_small < m_evals_large;
+  if (m_small_regime) {
+    // Small population, between the initial one and half of the last
+    // large one, with a smaller step size
+    double u = m_random.rand();
+    double large = m_lambda0*std::pow(m_config.getIncPopSize(), (double) m_n_large);
+    lambda = (std::size_t) (m_lambda0*std::pow(0.5*large/m_lambda0, u*u));
+    sigma *= std::pow(10., -2.*m_random.rand());
+  } else {
+    m_n_large++;
+    lambda = (std::size_t) std::round(m_lambda0*std::pow(m_config.getIncPopSize(), (double) m_n_large));
+  }
+  m_n_restarts++;
+
+  // Random mean in the search space
+  std::size_t d = m_search_space.getNumberOfParameters();
+  const Point& x = m_search_space.getRandom();
+  for (std::size_t j = 0; j < d; ++j) m_mean[j] = m_range[j] > 0. ? (x[j] - m_lower[j])/m_range[j] : 0.;
+
+  resetDistribution(std::max(lambda, (std::size_t) 2), sigma);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
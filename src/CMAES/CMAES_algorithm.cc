@@ -0,0 +1,48 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <CMAES/CMAES_algorithm.h>
+
+using namespace EmiROOT;
+
+template class EmiROOT::AlgorithmBase<CMAES_algorithm, CMAESPopulation, CMAESConfig>;
+
+CMAES_algorithm::CMAES_algorithm(const Function& obj_function, const CMAESConfig& config) :
+AlgorithmBase<CMAES_algorithm, CMAESPopulation, CMAESConfig>(obj_function, config) {}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void CMAES_algorithm::initialize() {
+  // Evaluate the cost for the population
+  m_population.evaluate();
+
+  // Centre the distribution on the best individuals
+  m_population.initDistribution();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void CMAES_algorithm::step() {
+  // Sample and evaluate a generation
+  m_population.sampleGeneration();
+
+  // Adapt the distribution
+  m_population.updateDistribution();
+
+  // Restart the converged runs
+  if (m_population.isConverged()) m_population.restart();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
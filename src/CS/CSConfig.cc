@@ -23,6 +23,7 @@ using namespace EmiROOT;
 CSConfig::CSConfig() : Config() {
   m_pa    = 0.;
   m_alpha = 0.;
+  m_n_eggs = 1;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
@@ -39,6 +40,12 @@ void CSConfig::setAlpha(double t) {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
+void CSConfig::setNEggs(std::size_t t) {
+  m_n_eggs = t;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
 double CSConfig::getPa() const {
   return m_pa;
 }
@@ -49,3 +56,9 @@ double CSConfig::getAlpha() const {
   return m_alpha;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::size_t CSConfig::getNEggs() const {
+  return m_n_eggs;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
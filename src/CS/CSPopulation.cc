@@ -20,7 +20,7 @@
 
 using namespace EmiROOT;
 
-CSPopulation::CSPopulation(Function func) : Population(func) {}
+CSPopulation::CSPopulation(Function func) : PopulationBase(func) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
@@ -28,19 +28,18 @@ void CSPopulation::init() {
   std::size_t pop_size = m_config.getPopulationSize();
   std::size_t d = m_search_space.getNumberOfParameters();
   m_individuals.resize(pop_size, Nest(d));
+  m_eggs.assign(std::max<std::size_t>(m_config.getNEggs(), 1), Nest(d));
+  m_hosts.assign(m_eggs.size(), 0);
+  m_normal.assign(2*d, 0.);
 
-  if (m_initial_population.size() > 0) {
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
 
-    // Load the positions provided by the user
-    for (std::size_t i = 0; i < (std::size_t) m_initial_population.size(); ++i) {
-      m_individuals[i].setPosition(m_initial_population[i]);
-    }
-
-  } else {
+  if (n_loaded < m_individuals.size()) {
 
-    // Generate randomly the position of the individuals
+    // Generate randomly the position of the other individuals
     if (!m_silent) std::cout << "Generating the initial population...\n";
-    for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+    for (std::size_t i = n_loaded; i < m_individuals.size(); ++i) {
       m_individuals[i].setPosition(m_search_space.getRandom());
     }
 
@@ -53,86 +52,67 @@ void CSPopulation::init() {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void CSPopulation::setConfig(const CSConfig& t_config) {
-  m_config = t_config;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-std::vector<std::vector<double> > CSPopulation::getPopulationPosition() {
-  std::vector<std::vector<double> > positions(m_individuals.size());
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) positions[i] = m_individuals[i].getPosition();
-  return positions;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-Nest* CSPopulation::getBestSolution() {
-  return &m_best_solution;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void CSPopulation::sort() {
-  std::sort(m_individuals.begin(), m_individuals.end());
+void CSPopulation::rank() {
+  EMIROOT_PROFILE(m_profiler, SORT);
+  std::size_t n = m_individuals.size();
+  std::size_t to_replace = std::min((std::size_t) std::round(m_config.getPa()*n), n - 1);
+  m_order.set(m_individuals);
+  m_order.select(n - to_replace);
+  m_order.partialSort(1, n - to_replace);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
 void CSPopulation::generateCuckooEgg() {
+  std::size_t n = m_individuals.size();
+  std::size_t d = m_search_space.getNumberOfParameters();
+  std::size_t to_replace = std::min((std::size_t) std::round(m_config.getPa()*n), n - 1);
 
-  // new solution by Lévy flights around the current best solutions
+  // the eggs, then the new nests, within the budget of evaluations
+  std::size_t n_eggs = std::min(m_eggs.size(), getRemainingEvaluations());
+  std::size_t n_new = std::min(to_replace, getRemainingEvaluations() - n_eggs);
+
+  // new solutions by Lévy flights around the current best solution
   double beta = 1.5;
   double sigma = 0.6966;
   double step = 0.;
-  std::size_t d = m_search_space.getNumberOfParameters();
-  Nest tmp(d);
-  for (std::size_t j = 0; j < d; ++j) {
-    step = m_config.getAlpha() * m_random.norm(0., sigma) / (pow(fabs(m_random.norm()), 1 / beta));
-    tmp[j] = m_individuals[0][j] + step;
-  }
-
-  // boundary check
-  checkBoundary(tmp);
-
-  // evaluate the new solution
-  evaluate(tmp);
+  const Nest& best = m_individuals[m_order[0]];
+  for (std::size_t e = 0; e < n_eggs; ++e) {
+    Nest& egg = m_eggs[e];
+    m_random.fillNorm(m_normal.data(), 2*d);
+    for (std::size_t j = 0; j < d; ++j) {
+      step = m_config.getAlpha() * (m_normal[2*j]*sigma) / (pow(fabs(m_normal[2*j + 1]), 1 / beta));
+      egg[j] = best[j] + step;
+    }
 
-  // choose a random nest (excluding the best)
-  int k = m_random.randUInt(1, m_individuals.size()); // [1, m_individuals.size)
+    // boundary check
+    checkBoundary(egg);
 
-  // if the new solution is better replace the selected nest
-  if (tmp.getCost() < m_individuals[k].getCost()) m_individuals[k] = tmp;
+    // choose a random nest (excluding the best)
+    m_hosts[e] = m_random.randUInt(1, n); // ranks [1, n)
+  }
 
   // a pa fraction of the sub-optimal solution are replaced by new ones
-  std::size_t to_replace = std::round(m_config.getPa()*m_individuals.size());
-  for (std::size_t i = 1; i <= to_replace; ++i) {
-    m_individuals[m_individuals.size()-i].setPosition(m_search_space.getRandom());
-
-    // evaluate the new solutions
-    evaluate(m_individuals[m_individuals.size()-i]);
+  for (std::size_t i = 1; i <= n_new; ++i) {
+    m_individuals[m_order[n-i]].setPosition(m_search_space.getRandom());
   }
 
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void CSPopulation::evaluate() {
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-    evaluate(m_individuals[i]);
+  // Evaluate the eggs and the new nests, concurrently if possible
+  auto evaluation = [this, n, n_eggs](std::size_t t) {
+    Nest& nest = t < n_eggs ? m_eggs[t] : m_individuals[m_order[n-1-(t-n_eggs)]];
+    evaluateInto(nest);
+  };
+  forEach(n_eggs + n_new, evaluation);
+
+  // if an egg is better than its nest it replaces it. The eggs laid in the
+  // abandoned nests are lost.
+  for (std::size_t e = 0; e < n_eggs; ++e) {
+    track(m_eggs[e]);
+    if (m_hosts[e] >= n - n_new) continue;
+    Nest& host = m_individuals[m_order[m_hosts[e]]];
+    if (m_eggs[e].getCost() < host.getCost()) host = m_eggs[e];
   }
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
-
-void CSPopulation::evaluate(Nest& solution) {
-  double value = evaluateCost(solution.getPosition());
-  solution.setCost(value);
-
-  if (value < m_best_solution.getCost()) {
-    if (ckeckViolateConstraints(solution.getPosition()) == false) {
-      m_best_solution = solution;
-    }
-  };
+  for (std::size_t i = 1; i <= n_new; ++i) track(m_individuals[m_order[n-i]]);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
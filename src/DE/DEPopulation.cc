@@ -0,0 +1,263 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <DE/DEPopulation.h>
+#include <Base/Kernels.h>
+#include <algorithm>
+#include <cmath>
+
+using namespace EmiROOT;
+
+DEPopulation::DEPopulation(Function func) : PopulationBase(func) {
+  m_n_trials = 0;
+  m_n_archive = 0;
+  m_n_pbest = 0;
+  m_initial_size = 0;
+  m_memory_pos = 0;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void DEPopulation::init() {
+  std::size_t pop_size = m_config.getPopulationSize();
+  std::size_t d = m_search_space.getNumberOfParameters();
+  if (pop_size < 4) {
+    std::cout << "The population of DE must have at least 4 individuals.\n";
+    abort();
+  }
+
+  m_individuals.resize(pop_size, Individual(d));
+  m_trials.assign(pop_size, Individual(d));
+  m_individual_random.clear();
+  for (std::size_t i = 0; i < pop_size; ++i) m_individual_random.push_back(m_random.split());
+  m_crossover.resize(pop_size*d);
+  m_f.resize(pop_size);
+  m_cr.resize(pop_size);
+  m_n_trials = 0;
+  m_initial_size = pop_size;
+
+  // The archive is used only by CURRENT_TO_PBEST_1
+  std::size_t archive_size = 0;
+  if (m_config.getStrategy() == CURRENT_TO_PBEST_1) archive_size = (std::size_t) std::round(m_config.getArchiveRate()*pop_size);
+  m_archive.assign(archive_size, Point(d));
+  m_n_archive = 0;
+
+  // Memory of SHADE, and lists of the successful parameters
+  m_memory_f.assign(m_config.getMemorySize(), 0.5);
+  m_memory_cr.assign(m_config.getMemorySize(), 0.5);
+  m_memory_pos = 0;
+  m_success_f.reserve(pop_size);
+  m_success_cr.reserve(pop_size);
+  m_success_weight.reserve(pop_size);
+
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
+
+  if (n_loaded < m_individuals.size()) {
+
+    // Generate randomly the position of the other individuals
+    if (!m_silent) std::cout << "Generating the initial population...\n";
+    for (std::size_t i = n_loaded; i < m_individuals.size(); ++i) {
+      m_individuals[i].setPosition(m_search_space.getRandom());
+    }
+
+  }
+
+  // Dummy assignment of the best individual. When the cost of
+  // the population is actually evaluated this is fixed.
+  m_best_solution = m_individuals[0];
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::size_t DEPopulation::drawIndex(Random& random, std::size_t n, std::size_t a, std::size_t b, std::size_t c) const {
+  std::size_t r;
+  do {
+    r = random.randUInt(0, n); // [0, n)
+  } while (r == a || r == b || r == c);
+  return r;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void DEPopulation::generateTrials() {
+  std::size_t n_pop = m_individuals.size();
+  std::size_t d = m_search_space.getNumberOfParameters();
+  m_n_trials = std::min(n_pop, getRemainingEvaluations());
+
+  DEStrategy strategy = m_config.getStrategy();
+  bool adaptive = m_config.isAdaptive();
+
+  // Best individuals among which x_pbest is drawn
+  if (strategy == CURRENT_TO_PBEST_1) {
+    m_n_pbest = std::min(n_pop, std::max((std::size_t) 2, (std::size_t) std::round(m_config.getPBest()*n_pop)));
+    EMIROOT_PROFILE(m_profiler, SORT);
+    m_order.set(m_individuals);
+    m_order.select(m_n_pbest);
+  }
+
+  // Position of an individual of the population or, beyond it, of the archive
+  auto position = [this, n_pop](std::size_t r) -> const double* {
+    if (r < n_pop) return static_cast<const Individual&>(m_individuals[r]).getPosition().data();
+    return m_archive[r - n_pop].data();
+  };
+
+  auto trial = [&, this](std::size_t i) {
+    Random& random = m_individual_random[i];
+
+    // Scale factor and crossover rate, drawn around an entry of the
+    // memory with SHADE: F from a Cauchy and CR from a normal distribution
+    double f = m_config.getF(), cr = m_config.getCR();
+    if (adaptive) {
+      std::size_t k = random.randUInt(0, m_memory_f.size());
+      cr = std::min(1., std::max(0., random.norm(m_memory_cr[k], 0.1)));
+      do {
+        f = m_memory_f[k] + 0.1*std::tan(M_PI*(random.rand() - 0.5));
+      } while (f <= 0.);
+      f = std::min(f, 1.);
+    }
+    m_f[i]  = f;
+    m_cr[i] = cr;
+
+    // Donors of the mutation
+    const double* x = position(i);
+    const double *base, *p, *q, *s = x, *t = x;
+    double g = 0.;
+    if (strategy == RAND_1) {
+      std::size_t r0 = drawIndex(random, n_pop, i, i, i);
+      std::size_t r1 = drawIndex(random, n_pop, i, r0, r0);
+      std::size_t r2 = drawIndex(random, n_pop, i, r0, r1);
+      base = position(r0);
+      p = position(r1);
+      q = position(r2);
+    } else if (strategy == BEST_1) {
+      std::size_t r1 = drawIndex(random, n_pop, i, i, i);
+      std::size_t r2 = drawIndex(random, n_pop, i, r1, r1);
+      base = static_cast<const Individual&>(m_best_solution).getPosition().data();
+      p = position(r1);
+      q = position(r2);
+    } else {
+      std::size_t pbest = m_order[random.randUInt(0, m_n_pbest)];
+      std::size_t r1 = drawIndex(random, n_pop, i, i, i);
+      std::size_t r2 = drawIndex(random, n_pop + m_n_archive, i, r1, r1);
+      base = x;
+      p = position(pbest);
+      q = x;
+      s = position(r1);
+      t = position(r2);
+      g = f;
+    }
+
+    // Binomial crossover, with at least one coordinate from the mutant
+    double* r = &m_crossover[i*d];
+    random.fill(r, d);
+    r[random.randUInt(0, d)] = -1.;
+
+    Individual& u = m_trials[i];
+    Kernels::differential(u.getPosition().data(), x, base, p, q, s, t, r, f, g, cr, d);
+
+    // boundary check
+    checkBoundary(u, random);
+
+    evaluateInto(u);
+  };
+  forEach(m_n_trials, trial);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void DEPopulation::archive(const Individual& t) {
+  // The capacity shrinks with the population
+  std::size_t capacity = std::min(m_archive.size(), (std::size_t) std::round(m_config.getArchiveRate()*m_individuals.size()));
+  if (capacity == 0) return;
+  if (m_n_archive < capacity) {
+    m_archive[m_n_archive++] = t.getPosition();
+  } else {
+    m_archive[m_random.randUInt(0, m_n_archive)] = t.getPosition();
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void DEPopulation::selectSurvivors() {
+  bool adaptive = m_config.isAdaptive();
+  m_success_f.clear();
+  m_success_cr.clear();
+  m_success_weight.clear();
+
+  for (std::size_t i = 0; i < m_n_trials; ++i) {
+    Individual& u = m_trials[i];
+    Individual& parent = m_individuals[i];
+    track(u);
+    if (u.getCost() > parent.getCost()) continue;
+
+    if (u.getCost() < parent.getCost()) {
+      if (adaptive) {
+        m_success_f.push_back(m_f[i]);
+        m_success_cr.push_back(m_cr[i]);
+        m_success_weight.push_back(parent.getCost() - u.getCost());
+      }
+      archive(parent);
+    }
+    std::swap(parent, u);
+  }
+
+  // Memory update with the means of the successful parameters, weighted
+  // by the improvement: Lehmer mean for F, arithmetic mean for CR
+  if (!adaptive || m_success_f.empty()) return;
+  double sum_w = 0., sum_f = 0., sum_f2 = 0., sum_cr = 0.;
+  for (std::size_t k = 0; k < m_success_f.size(); ++k) {
+    double w = m_success_weight[k];
+    sum_w  += w;
+    sum_f  += w*m_success_f[k];
+    sum_f2 += w*m_success_f[k]*m_success_f[k];
+    sum_cr += w*m_success_cr[k];
+  }
+  if (!(sum_w > 0.) || !std::isfinite(sum_w)) return;
+  m_memory_f[m_memory_pos]  = sum_f2/sum_f;
+  m_memory_cr[m_memory_pos] = sum_cr/sum_w;
+  m_memory_pos = (m_memory_pos + 1) % m_memory_f.size();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void DEPopulation::reducePopulation(std::size_t t) {
+  std::size_t min_size = m_config.getMinPopulationSize();
+  if (min_size == 0 || min_size >= m_initial_size) return;
+  min_size = std::max(min_size, (std::size_t) 4);
+
+  // Fraction of the run done, in evaluations if there is a budget
+  double progress = (double) t/m_config.getNMaxIterations();
+  if (m_max_evaluations > 0) progress = (double) getNEvaluations()/m_max_evaluations;
+  progress = std::min(1., progress);
+  std::size_t size = (std::size_t) std::round(m_initial_size + (min_size - (double) m_initial_size)*progress);
+  if (size >= m_individuals.size()) return;
+
+  // The worst individuals are removed
+  sort();
+  m_individuals.resize(size);
+
+  // The archive shrinks with the population, dropping random parents
+  std::size_t capacity = std::min(m_archive.size(), (std::size_t) std::round(m_config.getArchiveRate()*size));
+  while (m_n_archive > capacity) {
+    std::size_t k = m_random.randUInt(0, m_n_archive);
+    std::swap(m_archive[k], m_archive[m_n_archive - 1]);
+    m_n_archive--;
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
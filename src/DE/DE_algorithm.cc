@@ -0,0 +1,39 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <DE/DE_algorithm.h>
+
+using namespace EmiROOT;
+
+template class EmiROOT::AlgorithmBase<DE_algorithm, DEPopulation, DEConfig>;
+
+DE_algorithm::DE_algorithm(const Function& obj_function, const DEConfig& config) :
+AlgorithmBase<DE_algorithm, DEPopulation, DEConfig>(obj_function, config) {}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void DE_algorithm::step() {
+  // Mutation, crossover and evaluation of the trials
+  m_population.generateTrials();
+
+  // Selection between each individual and its trial
+  m_population.selectSurvivors();
+
+  // Linear reduction of the population size
+  m_population.reducePopulation(m_iter);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
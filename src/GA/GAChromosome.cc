@@ -24,26 +24,5 @@ GAChromosome::GAChromosome() : Individual() {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-GAChromosome::GAChromosome(int n) : Individual(n),
-m_indicator(0) {}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void GAChromosome::setIndicatorUp()
-{
-   m_indicator = 1;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-void GAChromosome::setIndicatorDown()
-{
-   m_indicator = 0;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-double GAChromosome::getIndicator() const
-{
-   return m_indicator;
-}
+GAChromosome::GAChromosome(int n) : Individual(n) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -42,12 +42,12 @@ void GAConfig::setKeepFraction(double t)
 
 void GAConfig::setConfigCrossover()
 {
-   m_keep   = floor(m_keep_fraction * getPopulationSize());
-   double k = m_keep * (m_keep + 1) / 2;
-   m_prob.push_back(m_keep / k);
-   for (int i = 2; i <= m_keep; i++) {
-      m_prob.push_back((m_keep - i + 1) / k + m_prob[i - 2]);
-   }
+   m_keep = floor(m_keep_fraction * getPopulationSize());
+
+   // The i-th best chromosome has weight m_keep - i
+   std::vector<double> weights(m_keep);
+   for (int i = 0; i < m_keep; i++) weights[i] = m_keep - i;
+   m_roulette.set(weights);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
@@ -71,6 +71,12 @@ int GAConfig::getKeep() const
 
 double GAConfig::getProb(int t) const
 {
-   return m_prob[t];
+   return m_roulette.getCumulative(t);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+const RouletteWheel& GAConfig::getRouletteWheel() const
+{
+   return m_roulette;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -20,7 +20,7 @@
 
 using namespace EmiROOT;
 
-GAPopulation::GAPopulation(Function func) : Population(func) {}
+GAPopulation::GAPopulation(Function func) : PopulationBase(func) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
@@ -31,18 +31,14 @@ void GAPopulation::init() {
   std::size_t d = m_search_space.getNumberOfParameters();
   m_individuals.resize(pop_size, GAChromosome(d));
 
-  if (m_initial_population.size() > 0) {
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
 
-    // Load the positions provided by the user
-    for (std::size_t i = 0; i < (std::size_t) m_initial_population.size(); ++i) {
-      m_individuals[i].setPosition(m_initial_population[i]);
-    }
-
-  } else {
+  if (n_loaded < m_individuals.size()) {
 
-    // Generate randomly the position of the whales
+    // Generate randomly the position of the other individuals
     if (!m_silent) std::cout << "Generating the initial population...\n";
-    for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+    for (std::size_t i = n_loaded; i < m_individuals.size(); ++i) {
       m_individuals[i].setPosition(m_search_space.getRandom());
     }
 
@@ -55,28 +51,11 @@ void GAPopulation::init() {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void GAPopulation::setConfig(const GAConfig& t_config) {
-  m_config = t_config;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-std::vector<std::vector<double> > GAPopulation::getPopulationPosition() {
-  std::vector<std::vector<double> > positions(m_individuals.size());
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) positions[i] = m_individuals[i].getPosition();
-  return positions;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-GAChromosome* GAPopulation::getBestSolution() {
-  return &m_best_solution;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void GAPopulation::sort() {
-  std::sort(m_individuals.begin(), m_individuals.end());
+void GAPopulation::rank() {
+  EMIROOT_PROFILE(m_profiler, SORT);
+  m_order.set(m_individuals);
+  // the best one is sorted anyway, being excluded from the mutation
+  m_order.partialSort(std::max(m_config.getKeep(), 1));
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
@@ -86,29 +65,21 @@ void GAPopulation::crossover() {
   double size = m_individuals.size();
   double ndof = m_search_space.getNumberOfParameters();
   std::size_t keep = m_config.getKeep();
+  const RouletteWheel& roulette = m_config.getRouletteWheel();
 
   for (std::size_t i = 0; i < (size - keep); i = i + 2) {
-    m_individuals[size - 1 - i].setIndicatorDown();
-    m_individuals[size - 2 - i].setIndicatorDown();
-    int    ma = 0, pa = 0;
-
-    // mother
-    double ra1 = m_random.rand();
-    for (std::size_t u = 1; u < keep; u++) {
-      if (ra1 > m_config.getProb(u - 1) && ra1 <= m_config.getProb(u)) ma = u;
-    }
-
-    // father
-    double ra2 = m_random.rand();
-    for (std::size_t u = 1; u < keep; u++) {
-      if (ra2 > m_config.getProb(u - 1) && ra2 <= m_config.getProb(u)) pa = u;
-    }
+    // mother and father, read through const references so
+    // that the survivors keep their cost
+    const GAChromosome& ma = m_individuals[m_order[roulette.select(m_random.rand())]];
+    const GAChromosome& pa = m_individuals[m_order[roulette.select(m_random.rand())]];
+
+    // the offspring replace the worst ranked chromosomes
+    GAChromosome& son      = m_individuals[m_order[size - 1 - i]];
+    GAChromosome& daughter = m_individuals[m_order[size - 2 - i]];
     for (std::size_t k = 0; k < ndof; k++) {
       double beta = m_random.rand();
-      m_individuals[size - 1 - i][k] = m_individuals[ma][k] -
-      beta * (m_individuals[ma][k] - m_individuals[pa][k]);
-      m_individuals[size - 2 - i][k] = m_individuals[pa][k] +
-      beta * (m_individuals[ma][k] - m_individuals[pa][k]);
+      son[k]      = ma[k] - beta * (ma[k] - pa[k]);
+      daughter[k] = pa[k] + beta * (ma[k] - pa[k]);
     }
   }
 }
@@ -123,31 +94,7 @@ void GAPopulation::mutation() {
   for (int i = 0; i < mutat; i++) {
     int ra1 = m_random.randUInt(0, ndof); // [0, ndof)
     int ra2 = m_random.randUInt(1, size); // [1, size)  elitism
-    m_individuals[ra2][ra1] = m_search_space.getRandom(ra1);
-    m_individuals[ra2].setIndicatorDown();
-  }
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void GAPopulation::evaluate() {
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-    evaluate(m_individuals[i]);
+    m_individuals[m_order[ra2]][ra1] = m_search_space.getRandom(ra1);
   }
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void GAPopulation::evaluate(GAChromosome& solution) {
-  double value = evaluateCost(solution.getPosition());
-  solution.setCost(value);
-  solution.setIndicatorDown();
-
-  if (value < m_best_solution.getCost()) {
-    if (ckeckViolateConstraints(solution.getPosition()) == false) {
-      m_best_solution = solution;
-    }
-  };
-
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
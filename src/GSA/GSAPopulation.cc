@@ -21,7 +21,9 @@
 
 using namespace EmiROOT;
 
-GSAPopulation::GSAPopulation(Function func) : Population(func) {}
+GSAPopulation::GSAPopulation(Function func) : PopulationBase(func) {
+  m_n_best = 0;
+}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
@@ -30,20 +32,17 @@ void GSAPopulation::init() {
   std::size_t d = m_search_space.getNumberOfParameters();
 
   m_individuals.resize(pop_size, Planet(d));
+  m_distance.assign(pop_size, std::vector<double>(pop_size, 0.));
 
-  if (m_initial_population.size() > 0) {
-
-    // Load the positions provided by the user
-    for (std::size_t i = 0; i < (std::size_t) m_initial_population.size(); ++i) {
-      m_individuals[i].setPosition(m_initial_population[i]);
-    }
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
 
-  } else {
+  if (n_loaded < m_individuals.size()) {
 
-    // Generate randomly the position of the Planets
+    // Generate randomly the position of the other individuals
     if (!m_silent) std::cout << "Generating the initial population...\n";
     double delta = 0.;
-    for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+    for (std::size_t i = n_loaded; i < m_individuals.size(); ++i) {
       m_individuals[i].setPosition(m_search_space.getRandom());
       for (std::size_t j = 0; j < d; ++j) {
         delta = m_search_space[j].getMax()-m_search_space[j].getMin();
@@ -59,40 +58,37 @@ void GSAPopulation::init() {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void GSAPopulation::setConfig(const GSAConfig& t_config) {
-  m_config = t_config;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-std::vector<std::vector<double> > GSAPopulation::getPopulationPosition() {
-  std::vector<std::vector<double> > positions(m_individuals.size());
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) positions[i] = m_individuals[i].getPosition();
-  return positions;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
+void GSAPopulation::rank(std::size_t iter) {
+  EMIROOT_PROFILE(m_profiler, SORT);
+  std::size_t iter_max = m_config.getNMaxIterations();
+  double Kbest = m_individuals.size() * (iter_max - iter) / (double)iter_max;
 
-Planet* GSAPopulation::getBestSolution() {
-  return &m_best_solution;
+  // the planets with rank lower than Kbest
+  m_n_best = std::min((std::size_t) std::ceil(Kbest), m_individuals.size());
+  m_order.set(m_individuals);
+  m_order.select(m_n_best);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
 void GSAPopulation::setMass() {
   double sum_mass = 0.;
-  std::vector<double> mass;
   double size = m_individuals.size();
-  double worst_cost = m_individuals[size - 1].getCost();
+  double worst_cost = m_individuals[0].getCost();
   double best_cost = m_individuals[0].getCost();
+  for (const Planet& planet : m_individuals) {
+    worst_cost = std::max(worst_cost, planet.getCost());
+    best_cost  = std::min(best_cost, planet.getCost());
+  }
   double delta_mass = worst_cost - best_cost;
 
+  // the unnormalized mass is stored in the planets first
   for (std::size_t i = 0; i < size ; ++i) {
-    mass.push_back((worst_cost - m_individuals[i].getCost())/delta_mass);
-    sum_mass += mass[i];
+    m_individuals[i].setMass((worst_cost - m_individuals[i].getCost())/delta_mass);
+    sum_mass += m_individuals[i].getMass();
   }
   for (std::size_t j = 0; j < size; ++j) {
-    m_individuals[j].setMass(mass[j] / sum_mass);
+    m_individuals[j].setMass(m_individuals[j].getMass() / sum_mass);
   }
 }
 
@@ -105,16 +101,13 @@ void GSAPopulation::setVelocity(std::size_t iter) {
 
   double grav = m_config.getGrav() * exp(- beta * (double)(iter)/(double)iter_max);
 
-  double Kbest = m_individuals.size() * (iter_max - iter) / (double)iter_max;
-
   std::size_t d = m_search_space.getNumberOfParameters();
   std::size_t pop_size = m_config.getPopulationSize();
 
   double accel = 0.;
 
   /// Compute distances between planets
-  std::vector<std::vector<double>> distance;
-  distance.resize(pop_size, std::vector<double>(pop_size, 0.));
+  std::vector<std::vector<double>>& distance = m_distance;
   for (std::size_t i = 0; i < pop_size; i++) {
     for (std::size_t j = 0; j < pop_size; j++) {
       distance[i][j] = 0.;
@@ -135,8 +128,9 @@ void GSAPopulation::setVelocity(std::size_t iter) {
 
     for (std::size_t k = 0; k < d; k++) {
       double ref_accel    = 0.;
-      for (std::size_t j = 0; j < pop_size; j++) {
-        if (distance[i][j] > 0. && j < Kbest) {
+      for (std::size_t r = 0; r < m_n_best; r++) {
+        std::size_t j = m_order[r];
+        if (distance[i][j] > 0.) {
           accel = grav * m_individuals[j].getMass() / (distance[i][j]) * (m_individuals[j][k] - m_individuals[i][k]);
           ref_accel += m_random.rand() * accel;
         }
@@ -173,31 +167,3 @@ void GSAPopulation::move(std::size_t iter) {
   }
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void GSAPopulation::evaluate() {
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-    evaluate(m_individuals[i]);
-  }
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void GSAPopulation::evaluate(Planet& solution) {
-  double value = evaluateCost(solution.getPosition());
-  solution.setCost(value);
-
-  // Update the best solution
-  if (value < m_best_solution.getCost()) {
-    if (ckeckViolateConstraints(solution.getPosition()) == false) {
-      m_best_solution = solution;
-    }
-  };
-
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-void GSAPopulation::sort() {
-  std::sort(m_individuals.begin(), m_individuals.end());
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
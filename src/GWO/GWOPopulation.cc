@@ -17,10 +17,11 @@
 
 
 #include <GWO/GWOPopulation.h>
+#include <Base/Kernels.h>
 
 using namespace EmiROOT;
 
-GWOPopulation::GWOPopulation(Function func) : Population(func) {
+GWOPopulation::GWOPopulation(Function func) : PopulationBase(func) {
   m_a = 0.;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -30,19 +31,16 @@ void GWOPopulation::init() {
   std::size_t pop_size = m_config.getPopulationSize();
   std::size_t d = m_search_space.getNumberOfParameters();
   m_individuals.resize(pop_size, Wolf(d));
+  m_random_numbers.resize(6*d);
 
-  if (m_initial_population.size() > 0) {
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
 
-    // Load the positions provided by the user
-    for (std::size_t i = 0; i < (std::size_t) m_initial_population.size(); ++i) {
-      m_individuals[i].setPosition(m_initial_population[i]);
-    }
-
-  } else {
+  if (n_loaded < m_individuals.size()) {
 
-    // Generate randomly the position of the individuals
+    // Generate randomly the position of the other individuals
     if (!m_silent) std::cout << "Generating the initial population...\n";
-    for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+    for (std::size_t i = n_loaded; i < m_individuals.size(); ++i) {
       m_individuals[i].setPosition(m_search_space.getRandom());
     }
 
@@ -58,26 +56,6 @@ void GWOPopulation::init() {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void GWOPopulation::setConfig(const GWOConfig& t_config) {
-  m_config = t_config;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-std::vector<std::vector<double> > GWOPopulation::getPopulationPosition() {
-  std::vector<std::vector<double> > positions(m_individuals.size());
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) positions[i] = m_individuals[i].getPosition();
-  return positions;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-Wolf* GWOPopulation::getBestSolution() {
-  return &m_best_solution;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
 void GWOPopulation::updateAParameter(std::size_t t) {
   m_a = 2 - t*(2./m_config.getNMaxIterations());
 }
@@ -85,36 +63,19 @@ void GWOPopulation::updateAParameter(std::size_t t) {
 
 
 void GWOPopulation::moveWolves() {
-  double r1, r2, A1, A2, A3, C1, C2, C3, D_alpha, D_beta, D_delta, X1, X2, X3;
+  std::size_t d = m_search_space.getNumberOfParameters();
+  const Wolf& alpha = m_alpha;
+  const Wolf& beta  = m_beta;
+  const Wolf& delta = m_delta;
 
   // Loop on the population of wolves
   for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+    // r1 and r2 of each coordinate for the three leaders, drawn at once
+    m_random.fill(m_random_numbers.data(), 6*d);
 
-    // Loop on dimension
-    for (std::size_t j = 0; j < m_individuals[0].getDimension(); ++j) {
-      r1      = m_random.rand();
-      r2      = m_random.rand();
-      A1      = 2*m_a*r1-m_a;
-      C1      = 2*r2;
-      D_alpha = fabs(C1*m_alpha[j]-m_individuals[i][j]);
-      X1      = m_alpha[j]-A1*D_alpha;
-
-      r1     = m_random.rand();
-      r2     = m_random.rand();
-      A2     = 2*m_a*r1-m_a;
-      C2     = 2*r2;
-      D_beta = fabs(C2*m_beta[j]-m_individuals[i][j]);
-      X2     = m_beta[j]-A2*D_beta;
-
-      r1      = m_random.rand();
-      r2      = m_random.rand();
-      A3      = 2*m_a*r1-m_a;
-      C3      = 2*r2;
-      D_delta = fabs(C3*m_delta[j]-m_individuals[i][j]);
-      X3      = m_delta[j]-A3*D_delta;
-
-      m_individuals[i][j] = (X1+X2+X3)/3.;
-    }
+    // move towards the average of the positions suggested by the leaders
+    Kernels::encircle(m_individuals[i].getPosition().data(), alpha.getPosition().data(), beta.getPosition().data(),
+                      delta.getPosition().data(), m_random_numbers.data(), m_a, d);
 
     // boundary check
     checkBoundary(m_individuals[i]);
@@ -123,17 +84,8 @@ void GWOPopulation::moveWolves() {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void GWOPopulation::evaluate() {
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-    evaluate(m_individuals[i]);
-  }
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void GWOPopulation::evaluate(Wolf& solution) {
-  double value = evaluateCost(solution.getPosition());
-  solution.setCost(value);
+void GWOPopulation::track(Wolf& solution) {
+  double value = solution.getCost();
 
   // Update the alpha, beta and delta wolves
   if (value < m_alpha.getCost()) {
@@ -151,11 +103,6 @@ void GWOPopulation::evaluate(Wolf& solution) {
     m_delta = solution;
   }
 
-  if (value < m_best_solution.getCost()) {
-    if (ckeckViolateConstraints(solution.getPosition()) == false) {
-      m_best_solution = solution;
-    }
-  };
-
+  PopulationBase::track(solution);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -17,6 +17,7 @@
 
 
 #include <HS/HSConfig.h>
+#include <algorithm>
 
 using namespace EmiROOT;
 
@@ -24,6 +25,7 @@ HSConfig::HSConfig() : Config() {
   m_hmcr = 0.;
   m_par  = 0.;
   m_bw   = 0.;
+  m_n_new = 1;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
@@ -46,6 +48,12 @@ void HSConfig::setBw(double t) {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
+void HSConfig::setNNewHarmonies(std::size_t t) {
+  m_n_new = std::max((std::size_t) 1, t);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
 double HSConfig::getHmcr() const {
   return m_hmcr;
 }
@@ -62,3 +70,9 @@ double HSConfig::getBw() const {
   return m_bw;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::size_t HSConfig::getNNewHarmonies() const {
+  return m_n_new;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -20,7 +20,7 @@
 
 using namespace EmiROOT;
 
-HSPopulation::HSPopulation(Function func) : Population(func) {}
+HSPopulation::HSPopulation(Function func) : PopulationBase(func) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
@@ -28,19 +28,16 @@ void HSPopulation::init() {
   std::size_t pop_size = m_config.getPopulationSize();
   std::size_t d = m_search_space.getNumberOfParameters();
   m_individuals.resize(pop_size, Individual(d));
+  m_new_harmonies.assign(m_config.getNNewHarmonies(), Individual(d));
 
-  if (m_initial_population.size() > 0) {
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
 
-    // Load the positions provided by the user
-    for (std::size_t i = 0; i < (std::size_t) m_initial_population.size(); ++i) {
-      m_individuals[i].setPosition(m_initial_population[i]);
-    }
-
-  } else {
+  if (n_loaded < m_individuals.size()) {
 
-    // Generate randomly the position of the individuals
+    // Generate randomly the position of the other individuals
     if (!m_silent) std::cout << "Generating the initial population...\n";
-    for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+    for (std::size_t i = n_loaded; i < m_individuals.size(); ++i) {
       m_individuals[i].setPosition(m_search_space.getRandom());
     }
 
@@ -53,83 +50,65 @@ void HSPopulation::init() {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void HSPopulation::setConfig(const HSConfig& t_config) {
-  m_config = t_config;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-std::vector<std::vector<double> > HSPopulation::getPopulationPosition() {
-  std::vector<std::vector<double> > positions(m_individuals.size());
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) positions[i] = m_individuals[i].getPosition();
-  return positions;
+void HSPopulation::sortMemory() {
+  EMIROOT_PROFILE(m_profiler, SORT);
+  m_memory.set(m_individuals);
+  m_memory.sort();
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-Individual* HSPopulation::getBestSolution() {
-  return &m_best_solution;
+double HSPopulation::scalePenaltyCoeff() {
+  double delta = PopulationBase::scalePenaltyCoeff();
+  if (delta != 0.) sortMemory();
+  return delta;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void HSPopulation::sort() {
-  std::sort(m_individuals.begin(), m_individuals.end());
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void HSPopulation::generateNewHarmony() {
+void HSPopulation::generateNewHarmonies() {
+  std::size_t n_new = std::min(m_new_harmonies.size(), getRemainingEvaluations());
   std::size_t d = m_search_space.getNumberOfParameters();
   double val = 0.;
-  Individual new_solution(d);
-
-  for (std::size_t j = 0; j < d; ++j) { // loop on dimension
-    if (m_random.rand() < m_config.getHmcr()) {
-      // choose from history
-      val = m_individuals[m_random.randUInt(0, m_individuals.size())][j]; // [0, m_individuals.size)
-
-      // check for pitch adjustment for recalled
-      if (m_random.rand() < m_config.getPar()) {
-        val += m_random.rand(-1., 1.)*m_config.getBw();
-      }
 
-      new_solution[j] = val;
-    } else {
-      // generate a new one
-      new_solution[j] = m_search_space.getRandom(j);
-    }
-  }
+  // All the new harmonies are improvised from the current memory
+  for (std::size_t h = 0; h < n_new; ++h) {
+    Individual& new_solution = m_new_harmonies[h];
 
-  // boundary check
-  checkBoundary(new_solution);
+    for (std::size_t j = 0; j < d; ++j) { // loop on dimension
+      if (m_random.rand() < m_config.getHmcr()) {
+        // choose from history (the memory is accessed by rank)
+        val = m_individuals[m_memory[m_random.randUInt(0, m_individuals.size())]][j]; // [0, m_individuals.size)
 
-  // check if the new solution if better than the worst in the population
-  evaluate(new_solution);
-  if (new_solution.getCost() < m_individuals[m_individuals.size()-1].getCost()) {
-    m_individuals[m_individuals.size()-1] = new_solution;
-  }
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+        // check for pitch adjustment for recalled
+        if (m_random.rand() < m_config.getPar()) {
+          val += m_random.rand(-1., 1.)*m_config.getBw();
+        }
 
+        new_solution[j] = val;
+      } else {
+        // generate a new one
+        new_solution[j] = m_search_space.getRandom(j);
+      }
+    }
 
-void HSPopulation::evaluate() {
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-    evaluate(m_individuals[i]);
+    // boundary check
+    checkBoundary(new_solution);
   }
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
+  // Evaluate the new harmonies, concurrently if possible
+  forEach(n_new, [this](std::size_t h) {evaluateInto(m_new_harmonies[h]);});
 
-void HSPopulation::evaluate(Individual& solution) {
-  double value = evaluateCost(solution.getPosition());
-  solution.setCost(value);
+  // check if the new solutions are better than the worst in the memory
+  for (std::size_t h = 0; h < n_new; ++h) {
+    track(m_new_harmonies[h]);
+    if (m_new_harmonies[h].getCost() < m_memory.getWorstCost()) {
+      std::size_t worst = m_memory.getWorst();
+      std::swap(m_individuals[worst], m_new_harmonies[h]);
 
-  if (value < m_best_solution.getCost()) {
-    if (ckeckViolateConstraints(solution.getPosition()) == false) {
-      m_best_solution = solution;
+      EMIROOT_PROFILE(m_profiler, SORT);
+      m_memory.update(m_memory.getSize() - 1, m_individuals[worst].getCost());
     }
-  };
-
+  }
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -17,6 +17,7 @@
 
 
 #include <IHS/IHSConfig.h>
+#include <algorithm>
 
 using namespace EmiROOT;
 
@@ -26,6 +27,7 @@ IHSConfig::IHSConfig() : Config() {
   m_par_max         = 0.;
   m_bw_min          = 0.;
   m_bw_max          = 0.;
+  m_n_new           = 1;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
@@ -56,6 +58,11 @@ void IHSConfig::setBwMax(double t) {
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
+void IHSConfig::setNNewHarmonies(std::size_t t) {
+  m_n_new = std::max((std::size_t) 1, t);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
 
 double IHSConfig::getHmcr() const {
   return m_hmcr;
@@ -85,3 +92,8 @@ double IHSConfig::getBwMax() const {
   return m_bw_max;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+std::size_t IHSConfig::getNNewHarmonies() const {
+  return m_n_new;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
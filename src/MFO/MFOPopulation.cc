@@ -17,10 +17,11 @@
 
 
 #include <MFO/MFOPopulation.h>
+#include <Base/Kernels.h>
 
 using namespace EmiROOT;
 
-MFOPopulation::MFOPopulation(Function func) : Population(func) {
+MFOPopulation::MFOPopulation(Function func) : PopulationBase(func) {
   m_a = 0.;
   m_n_flame = 0;
 }
@@ -31,19 +32,18 @@ void MFOPopulation::init() {
   std::size_t pop_size = m_config.getPopulationSize();
   std::size_t d = m_search_space.getNumberOfParameters();
   m_individuals.resize(pop_size, Moth(d));
+  m_spiral.resize(pop_size*d);
+  m_moth_random.clear();
+  for (std::size_t i = 0; i < pop_size; ++i) m_moth_random.push_back(m_random.split());
 
-  if (m_initial_population.size() > 0) {
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
 
-    // Load the positions provided by the user
-    for (std::size_t i = 0; i < (std::size_t) m_initial_population.size(); ++i) {
-      m_individuals[i].setPosition(m_initial_population[i]);
-    }
-
-  } else {
+  if (n_loaded < m_individuals.size()) {
 
-    // Generate randomly the position of the individuals
+    // Generate randomly the position of the other individuals
     if (!m_silent) std::cout << "Generating the initial population...\n";
-    for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+    for (std::size_t i = n_loaded; i < m_individuals.size(); ++i) {
       m_individuals[i].setPosition(m_search_space.getRandom());
     }
 
@@ -56,29 +56,15 @@ void MFOPopulation::init() {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void MFOPopulation::setConfig(const MFOConfig& t_config) {
-  m_config = t_config;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-std::vector<std::vector<double> > MFOPopulation::getPopulationPosition() {
-  std::vector<std::vector<double> > positions(m_individuals.size());
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) positions[i] = m_individuals[i].getPosition();
-  return positions;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-Moth* MFOPopulation::getBestSolution() {
-  return &m_best_solution;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
 void MFOPopulation::createFlames() {
-  m_flames = m_individuals;
-  std::sort(m_flames.begin(), m_flames.end());
+  EMIROOT_PROFILE(m_profiler, SORT);
+  m_order.set(m_individuals);
+  m_order.sort();
+  m_flames.resize(m_individuals.size(), m_individuals[0]);
+  for (std::size_t r = 0; r < m_flames.size(); ++r) m_flames[r] = m_individuals[m_order[r]];
+
+  // buffer used to merge moths and flames
+  m_merged.resize(m_flames.size(), m_flames[0]);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
@@ -91,54 +77,68 @@ void MFOPopulation::updateParameters(std::size_t t) {
 
 
 void MFOPopulation::moveMoths() {
-  double d_flame, r, b = 1.;
-  // Loop on the population of moths
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+  // Each moth flies along a logarithmic spiral around its flame. The
+  // flames are only read, and each moth draws from its own random stream.
+  std::size_t n = std::min(m_individuals.size(), getRemainingEvaluations());
+  std::size_t d = m_search_space.getNumberOfParameters();
 
-    // Loop on dimension
-    for (std::size_t j = 0; j < m_individuals[0].getDimension(); ++j) {
+  auto fly = [this, d](std::size_t i) {
+    double b = 1.;
+    Moth& moth = m_individuals[i];
+    Random& random = m_moth_random[i];
 
-      d_flame = fabs(m_flames[i][j] - m_individuals[i][j]);
-      r       = (m_a - 1.)*m_random.rand() + 1.;
+    // one spiral parameter in [a, 1] per coordinate
+    double* r = &m_spiral[i*d];
+    random.fill(r, d);
+    for (std::size_t j = 0; j < d; ++j) r[j] = (m_a - 1.)*r[j] + 1.;
 
-      if (i <= m_n_flame) {
-        m_individuals[i][j] = d_flame*exp(b*r)*cos(r*2*M_PI) + m_flames[i][j];
-      } else {
-        m_individuals[i][j] = d_flame*exp(b*r)*cos(r*2*M_PI) + m_flames[m_n_flame][j];
-      }
+    // the moths beyond the number of flames follow the last one
+    const Moth& flame = m_flames[std::min(i, m_n_flame)];
+    Kernels::spiral(moth.getPosition().data(), flame.getPosition().data(), r, b, d);
 
-      // boundary check
-      checkBoundary(m_individuals[i]);
-    }
-  }
+    // boundary check
+    checkBoundary(moth, random);
 
-  // combine moths with flames and sort them
-  m_flames.insert(m_flames.end(), m_individuals.begin(), m_individuals.end());
-  std::sort(m_flames.begin(), m_flames.end());
+    evaluateInto(moth);
+  };
+  forEach(n, fly);
 
-  // keep the best
-  m_flames.resize(m_individuals.size());
+  for (std::size_t i = 0; i < n; ++i) track(m_individuals[i]);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void MFOPopulation::evaluate() {
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-    evaluate(m_individuals[i]);
+double MFOPopulation::scalePenaltyCoeff() {
+  double delta = PopulationBase::scalePenaltyCoeff();
+  if (delta != 0. && !m_flames.empty()) {
+    rescalePenalty(m_flames, delta);
+    EMIROOT_PROFILE(m_profiler, SORT);
+    m_order.set(m_flames);
+    m_order.sort();
+    m_order.permute(m_flames);
   }
+  return delta;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void MFOPopulation::evaluate(Moth& solution) {
-  double value = evaluateCost(solution.getPosition());
-  solution.setCost(value);
-
-  if (value < m_best_solution.getCost()) {
-    if (ckeckViolateConstraints(solution.getPosition()) == false) {
-      m_best_solution = solution;
+void MFOPopulation::updateFlames() {
+  // merge the moths with the flames, which are already sorted: only the
+  // keys of the moths are sorted and the best ones become the new flames
+  EMIROOT_PROFILE(m_profiler, SORT);
+  m_order.set(m_individuals);
+  m_order.sort();
+  std::size_t f = 0, m = 0;
+  for (std::size_t r = 0; r < m_flames.size(); ++r) {
+    // the moths not evaluated, when the budget is exhausted, are skipped
+    while (m < m_order.getSize() && !m_individuals[m_order[m]].isEvaluated()) ++m;
+
+    if (m < m_order.getSize() && m_order.getCost(m) < m_flames[f].getCost()) {
+      m_merged[r] = m_individuals[m_order[m++]];
+    } else {
+      m_merged[r] = m_flames[f++];
     }
-  };
-
+  }
+  std::swap(m_flames, m_merged);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
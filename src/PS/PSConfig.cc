@@ -24,6 +24,8 @@ PSConfig::PSConfig() : Config() {
   m_cognitive = 0.;
   m_social    = 0.;
   m_inertia   = 0.;
+  m_topology  = GBEST;
+  m_n_informants = 3;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
@@ -52,6 +54,16 @@ void PSConfig::setInertia(double t) {
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
+void PSConfig::setTopology(PSTopology t) {
+  m_topology = t;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void PSConfig::setNInformants(std::size_t t) {
+  m_n_informants = t;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
 const std::vector<double>& PSConfig::getAlpha() const {
   return m_alpha;
 }
@@ -77,3 +89,13 @@ double PSConfig::getInertia() const {
   return m_inertia;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+PSTopology PSConfig::getTopology() const {
+  return m_topology;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+std::size_t PSConfig::getNInformants() const {
+  return m_n_informants;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
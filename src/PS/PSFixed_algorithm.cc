@@ -0,0 +1,44 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+*/
+
+
+#include <PS/PSFixed_algorithm.h>
+#include <PS/PS_algorithm.h>
+
+using namespace EmiROOT;
+
+namespace {
+
+  /// Instantiate the specialisation matching the dimension, starting from D
+  template<std::size_t D>
+  std::unique_ptr<Algorithm> makeFixed(const Function& obj_function, const PSConfig& config, std::size_t d) {
+    if (d == D) return std::unique_ptr<Algorithm>(new PSFixed_algorithm<D>(obj_function, config));
+    if constexpr (D < PSFixedMaxDimension) {
+      return makeFixed<D+1>(obj_function, config, d);
+    } else {
+      return std::unique_ptr<Algorithm>(new PS_algorithm(obj_function, config));
+    }
+  }
+
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+std::unique_ptr<Algorithm> EmiROOT::makePSAlgorithm(const Function& obj_function, const PSConfig& config, std::size_t d) {
+  return makeFixed<1>(obj_function, config, d);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
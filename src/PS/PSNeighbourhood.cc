@@ -0,0 +1,98 @@
+/*
+###############################################################################
+# EmiROOT: Evolutionary minimization for ROOT                                  #
+# Copyright (C) 2022 Davide Pagano & Lorenzo Sostero                          #
+#                                                                             #
+# This program is free software: you can redistribute it and/or modify        #
+# it under the terms of the GNU General Public License as published by        #
+# the Free Software Foundation, either version 3 of the License, or           #
+# any later version.                                                          #
+#                                                                             #
+# This program is distributed in the hope that it will be useful, but         #
+# WITHOUT ANY WARRANTY; without even the implied warranty of MERCHANTABILITY  #
+# or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License    #
+# for more details: <https://www.gnu.org/licenses/>.                          #
+###############################################################################
+ */
+
+
+#include <PS/PSNeighbourhood.h>
+#include <algorithm>
+#include <cmath>
+
+using namespace EmiROOT;
+
+PSNeighbourhood::PSNeighbourhood() : m_topology(GBEST), m_size(1), m_n_random(0),
+m_best_cost(std::numeric_limits<double>::max()) {}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void PSNeighbourhood::init(std::size_t n, const PSConfig& config, Random& random) {
+  m_topology  = config.getTopology();
+  m_best_cost = std::numeric_limits<double>::max();
+  m_best.assign(n, 0);
+
+  if (m_topology == GBEST || n == 0) {
+    m_size = 1;
+    m_informants.clear();
+    return;
+  }
+
+  if (m_topology == RING) {
+
+    // the particle and its two neighbours on the ring
+    m_size = 3;
+    m_informants.resize(n*m_size);
+    for (std::size_t i = 0; i < n; ++i) {
+      m_informants[i*m_size]     = i;
+      m_informants[i*m_size + 1] = (i + n - 1) % n;
+      m_informants[i*m_size + 2] = (i + 1) % n;
+    }
+
+  } else if (m_topology == VON_NEUMANN) {
+
+    // the particle and its four neighbours on a toroidal grid with
+    // about sqrt(n) columns, laid out row by row. The last row can be
+    // shorter: rows and columns wrap around on their own length.
+    std::size_t cols = std::max<std::size_t>(1, std::lround(std::sqrt((double) n)));
+    m_size = 5;
+    m_informants.resize(n*m_size);
+    for (std::size_t i = 0; i < n; ++i) {
+      std::size_t row    = i / cols;
+      std::size_t col    = i % cols;
+      std::size_t width  = std::min(cols, n - row*cols);  // particles in the row
+      std::size_t height = (n - col + cols - 1) / cols;   // particles in the column
+      m_informants[i*m_size]     = i;
+      m_informants[i*m_size + 1] = row*cols + (col + width - 1) % width;
+      m_informants[i*m_size + 2] = row*cols + (col + 1) % width;
+      m_informants[i*m_size + 3] = ((row + height - 1) % height)*cols + col;
+      m_informants[i*m_size + 4] = ((row + 1) % height)*cols + col;
+    }
+
+  } else if (m_topology == RANDOM_K) {
+
+    m_n_random = config.getNInformants();
+    m_size = m_n_random + 1;
+    m_informants.resize(n*m_size);
+    drawInformants(random);
+
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void PSNeighbourhood::update(double best_cost, Random& random) {
+  if (m_topology == RANDOM_K && !(best_cost < m_best_cost)) drawInformants(random);
+  m_best_cost = std::min(m_best_cost, best_cost);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+
+void PSNeighbourhood::drawInformants(Random& random) {
+  std::size_t n = m_best.size();
+  for (std::size_t i = 0; i < n; ++i) {
+    m_informants[i*m_size] = i;
+    for (std::size_t k = 1; k < m_size; ++k) m_informants[i*m_size + k] = random.randUInt(0, n);
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
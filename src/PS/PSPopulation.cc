@@ -17,10 +17,11 @@
 
 
 #include <PS/PSPopulation.h>
+#include <Base/Kernels.h>
 
 using namespace EmiROOT;
 
-PSPopulation::PSPopulation(Function func) : Population(func) {}
+PSPopulation::PSPopulation(Function func) : PopulationBase(func) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
@@ -43,19 +44,15 @@ void PSPopulation::init() {
 
   m_individuals.resize(pop_size, PSParticle(d));
 
-  if (m_initial_population.size() > 0) {
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
 
-    // Load the positions provided by the user
-    for (std::size_t i = 0; i < (std::size_t) m_initial_population.size(); ++i) {
-      m_individuals[i].setPosition(m_initial_population[i]);
-    }
-
-  } else {
+  if (n_loaded < m_individuals.size()) {
 
-    // Generate randomly the position of the Planets
+    // Generate randomly the position of the other individuals
     if (!m_silent) std::cout << "Generating the initial population...\n";
     double delta = 0.;
-    for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+    for (std::size_t i = n_loaded; i < m_individuals.size(); ++i) {
       m_individuals[i].setPosition(m_search_space.getRandom());
       for (std::size_t j = 0; j < d; ++j) {
         delta = m_search_space[j].getMax()-m_search_space[j].getMin();
@@ -64,6 +61,14 @@ void PSPopulation::init() {
     }
   }
 
+  // Random stream of each particle, buffers of the velocity update and
+  // informants of the particles
+  m_particle_random.clear();
+  for (std::size_t i = 0; i < pop_size; ++i) m_particle_random.push_back(m_random.split());
+  m_random_numbers.assign(2*d*pop_size, 0.);
+  m_max_velocity.assign(d, 0.);
+  m_neighbourhood.init(pop_size, m_config, m_random);
+
   // Dummy assignment of the best planet. When the cost of
   // the population is actually evaluated this is fixed.
   m_best_solution = m_individuals[0];
@@ -71,96 +76,84 @@ void PSPopulation::init() {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void PSPopulation::setConfig(const PSConfig& t_config) {
-  m_config = t_config;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-std::vector<std::vector<double>> PSPopulation::getPopulationPosition() {
-  std::vector<std::vector<double>> positions(m_individuals.size());
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) positions[i] = m_individuals[i].getPosition();
-  return positions;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-PSParticle* PSPopulation::getBestSolution() {
-  return &m_best_solution;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void PSPopulation::setVelocity(std::size_t iter) {
-  std::vector<double> alpha = m_config.getAlpha();
-  double inertia_initial = m_config.getInertia();
+void PSPopulation::updateParameters(std::size_t iter) {
+  const std::vector<double>& alpha = m_config.getAlpha();
   double h = m_config.getAlphaEvolution();
   std::size_t iter_max = m_config.getNMaxIterations();
 
-  double cognitive_par = m_config.getCognitiveParameter();
-  double social_par = m_config.getSocialParameter();
-  double inertia = inertia_initial * (1.0 - 0.5 * ((double)(iter)/(double)iter_max));
+  m_cognitive = m_config.getCognitiveParameter();
+  m_social = m_config.getSocialParameter();
+  m_inertia = m_config.getInertia() * (1.0 - 0.5 * ((double)(iter)/(double)iter_max));
   double k = std::pow(1.0 - ((double)(iter)/(double)iter_max), h);
 
-  std::transform(alpha.begin(), alpha.end(), alpha.begin(), [k](double &c) { return c*k; });
+  // maximum velocity, shrinking with the iterations
+  for (std::size_t j = 0; j < m_max_velocity.size(); ++j) {
+    m_max_velocity[j] = alpha[j] * k * (m_search_space[j].getMax() - m_search_space[j].getMin());
+  }
+
+  // with a local topology each particle follows the best personal
+  // position among its informants
+  if (!m_neighbourhood.isGlobal()) {
+    m_neighbourhood.update(m_best_solution.getCost(), m_random);
+    m_neighbourhood.findBest([this](std::size_t t) {return m_individuals[t].getBestCost();});
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
-  for (std::size_t j = 0; j < m_individuals[0].getDimension(); ++j) {
 
-    double delta = m_search_space[j].getMax() - m_search_space[j].getMin();
+void PSPopulation::updateVelocity(std::size_t i) {
+  std::size_t d = m_max_velocity.size();
+  PSParticle& particle = m_individuals[i];
+  const PSParticle& c = particle;
 
-    for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-      // Compute the step and assign if it satisfies the constraint on the maximum velocity
-      double cognitive = cognitive_par * m_random.rand() *
-      (m_individuals[i].getBestPositionParticle(j) - m_individuals[i][j]);
-      double social = social_par * m_random.rand() *
-      (m_best_solution[j] - m_individuals[i][j]);
-      double vel = (m_individuals[i].getVelocity(j) * inertia + cognitive + social);
+  // the cognitive random numbers, then the social ones
+  double* r = &m_random_numbers[2*d*i];
+  m_particle_random[i].fill(r, 2*d);
 
-      if (fabs(vel) < alpha[j] * delta) {
-        m_individuals[i].setVelocity(j, vel);
-      } else {
-        if (vel > alpha[j] * delta) {
-          m_individuals[i].setVelocity(j, alpha[j] * delta);
-        } else {
-          m_individuals[i].setVelocity(j, - alpha[j] * delta);
-        }
-      }
+  // the other particles are only read, through const references
+  const PSParticle& best = m_best_solution;
+  const std::vector<double>& guide = m_neighbourhood.isGlobal() ? best.getPosition() :
+  static_cast<const PSParticle&>(m_individuals[m_neighbourhood[i]]).getBestPositionParticle();
 
-    }
-  }
+  Kernels::velocity(particle.getVelocity().data(), c.getPosition().data(), c.getBestPositionParticle().data(),
+                    guide.data(), r, m_inertia, m_cognitive, m_social, m_max_velocity.data(), d);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
 void PSPopulation::moveParticles(std::size_t iter) {
-  // Change the velocity of the particles
-  setVelocity(iter);
+  // The velocities only read the personal best positions and the best
+  // solution, which are updated after all the particles are moved, and
+  // each particle draws from its own random stream.
+  updateParameters(iter);
 
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-    for (std::size_t j = 0; j < m_individuals[0].getDimension(); ++j) {
-      m_individuals[i][j] = m_individuals[i][j] + m_individuals[i].getVelocity(j);
-    }
+  std::size_t n = std::min(m_individuals.size(), getRemainingEvaluations());
+  std::size_t d = m_max_velocity.size();
+
+  auto fly = [this, d](std::size_t i) {
+    updateVelocity(i);
+
+    PSParticle& particle = m_individuals[i];
+    double* x = particle.getPosition().data();
+    const double* v = particle.getVelocity().data();
+    for (std::size_t j = 0; j < d; ++j) x[j] += v[j];
 
     // boundary check
-    checkBoundary(m_individuals[i]);
-  }
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+    checkBoundary(particle, m_particle_random[i]);
 
+    evaluateInto(particle);
+  };
+  forEach(n, fly);
 
-void PSPopulation::evaluate() {
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-    evaluate(m_individuals[i]);
-  }
+  for (std::size_t i = 0; i < n; ++i) track(m_individuals[i]);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void PSPopulation::evaluate(PSParticle& solution) {
-  double value = evaluateCost(solution.getPosition());
-  solution.setCost(value);
+void PSPopulation::track(PSParticle& solution) {
+  double value = solution.getCost();
 
-  if (ckeckViolateConstraints(solution.getPosition()) == false) {
+  if (ckeckViolateConstraints(static_cast<const PSParticle&>(solution).getPosition()) == false) {
 
     // Update personal best solution
     solution.setPersonalBest();
@@ -21,16 +21,27 @@
 using namespace EmiROOT;
 
 SAConfig::SAConfig() : Config() {
+  m_replica_exchange  = false;
+  m_temperature_ratio = 100.;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 void SAConfig::setRouletteWheel() {
-   double m_keep   = getPopulationSize();
-   double k = m_keep * (m_keep + 1) / 2;
-   m_Prob.push_back(m_keep / k);
-   for (std::size_t i = 2; i <= m_keep; i++) {
-      m_Prob.push_back((m_keep - i + 1) / k + m_Prob[i - 2]);
-   }
+   // The i-th best particle has weight n - i
+   std::size_t n = getPopulationSize();
+   std::vector<double> weights(n);
+   for (std::size_t i = 0; i < n; i++) weights[i] = n - i;
+   m_roulette.set(weights);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void SAConfig::setReplicaExchange(bool t) {
+  m_replica_exchange = t;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void SAConfig::setTemperatureRatio(double t) {
+  m_temperature_ratio = t;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
@@ -105,6 +116,21 @@ double SAConfig::getWmin() const{
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 double SAConfig::getProb(int t) const{
-   return m_Prob[t];
+   return m_roulette.getCumulative(t);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+const RouletteWheel& SAConfig::getRouletteWheel() const{
+   return m_roulette;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+bool SAConfig::isReplicaExchange() const {
+  return m_replica_exchange;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+double SAConfig::getTemperatureRatio() const {
+  return m_temperature_ratio;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -49,7 +49,7 @@ double SAParticle::getVelocity(std::size_t t) {
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
-double SAParticle::getBestPositionComponent(std::size_t t) {
+double SAParticle::getBestPositionComponent(std::size_t t) const {
   return m_position_best[t];
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -59,7 +59,7 @@ double SAParticle::getBestCostParticle() {
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
-std::vector<std::size_t> SAParticle::getSuccess() {
+const std::vector<std::size_t>& SAParticle::getSuccess() const {
   return m_success;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -20,27 +20,26 @@
 
 using namespace EmiROOT;
 
-SAPopulation::SAPopulation(Function func) : Population(func) {}
+SAPopulation::SAPopulation(Function func) : PopulationBase(func) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
 void SAPopulation::init() {
+  m_config.setRouletteWheel();
+
   std::size_t pop_size = m_config.getPopulationSize();
   std::size_t d = m_search_space.getNumberOfParameters();
   m_individuals.resize(pop_size, SAParticle(d));
 
-  if (m_initial_population.size() > 0) {
-
-    // Load the positions provided by the user
-    for (std::size_t i = 0; i < (std::size_t) m_initial_population.size(); ++i) {
-      m_individuals[i].setPosition(m_initial_population[i]);
-    }
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
 
-  } else {
+  if (n_loaded < m_individuals.size()) {
 
+    // Generate randomly the position of the other individuals
     if (!m_silent) std::cout << "Generating the initial population...\n";
     double delta = 0.;
-    for (std::size_t i = 0; i < pop_size; ++i) {
+    for (std::size_t i = n_loaded; i < pop_size; ++i) {
       m_individuals[i].setPosition(m_search_space.getRandom());
       for (std::size_t j = 0; j < d; ++j) {
         delta = m_search_space[j].getMax() - m_search_space[j].getMin();
@@ -49,65 +48,193 @@ void SAPopulation::init() {
     }
   }
 
+  // Candidate and random stream of each particle
+  m_candidates.assign(pop_size, SAParticle(d));
+  m_particle_random.clear();
+  for (std::size_t i = 0; i < pop_size; ++i) m_particle_random.push_back(m_random.split());
+
+  // Replica exchange mode: the ladder starts with the same ratio between
+  // all the neighbouring temperatures
+  if (m_config.isReplicaExchange()) {
+    m_replica.resize(pop_size);
+    for (std::size_t k = 0; k < pop_size; ++k) m_replica[k] = k;
+    m_temperature.assign(pop_size, m_config.getT0());
+    std::size_t n_pairs = pop_size > 0 ? pop_size - 1 : 0;
+    m_log_gap.assign(n_pairs, n_pairs > 0 ? log(m_config.getTemperatureRatio())/n_pairs : 0.);
+    m_swap_attempts.assign(n_pairs, 0);
+    m_swap_accepted.assign(n_pairs, 0);
+    m_n_exchanges = 0;
+    m_n_adaptations = 0;
+  }
+
   // Dummy assignment of the best solution. When the cost of
   // the population is actually evaluated this is fixed.
   m_best_solution = m_individuals[0];
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
+void SAPopulation::move() {
+  // The temperatures are only read, and each particle sweeps from its own
+  // random stream. The budget is shared in whole sweeps, the last particle
+  // possibly getting a partial one.
+  std::size_t d = m_search_space.getNumberOfParameters();
+  std::size_t n = m_individuals.size();
+  std::size_t remaining = getRemainingEvaluations();
+  std::size_t n_full = std::min(n, remaining/d);
 
-void SAPopulation::setConfig(const SAConfig& t_config) {
-  m_config = t_config;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+  if (m_config.isReplicaExchange()) updateTemperatures();
 
+  forEach(n_full, [this, d](std::size_t i) {sweep(i, d);});
+  if (n_full < n && remaining % d > 0) sweep(n_full, remaining % d);
 
-std::vector<std::vector<double>> SAPopulation::getPopulationPosition() {
-  std::vector<std::vector<double>> positions(m_individuals.size());
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) positions[i] = m_individuals[i].getPosition();
-  return positions;
+  // update the best solution with the best points of the particles
+  for (SAParticle& particle : m_individuals) {
+    if (particle.getBestCostParticle() < m_best_solution.getCost()) {
+      m_best_solution = particle;
+      m_best_solution.setPosition(particle.getBestPositionParticle());
+      m_best_solution.setCost(particle.getBestCostParticle());
+    }
+  }
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
-void SAPopulation::move() {
-  std::size_t d = m_search_space.getNumberOfParameters();
-  SAParticle tmp;
-  double cost_tmp;
-  double cost_part;
-  double temperature = m_config.getT0();
+void SAPopulation::sweep(std::size_t i, std::size_t n_trials) {
+  SAParticle& particle = m_individuals[i];
+  const SAParticle& c = particle;
+  Random& random = m_particle_random[i];
+  double temperature = m_config.isReplicaExchange() ? m_temperature[i] : m_config.getT0();
+
+  for (std::size_t h = 0; h < n_trials; h++) { // loop on dimension
+    // After a new starting point the cost of the particle is the one of
+    // its previous position, and the full cost is evaluated
+    double cost_part = c.getCost();
+    double violation;
+    double cost;
+
+    if (m_constraints.empty()) {
+
+      // Only the coordinate h can change: it is moved in place, evaluated
+      // from the cost of the particle and restored if the move is rejected
+      double x_part = c[h];
+      double v_part = particle.getVelocity(h);
+      double violation_part = c.getViolation();
+      bool evaluated = c.isEvaluated();
+
+      particle[h] += random.rand(-1., 1.) * v_part;
+      checkBoundary(particle, h, random);
+
+      cost = evaluated ? evaluateCost(particle.getPosition(), h, x_part, cost_part, violation) :
+      evaluateCost(particle.getPosition(), violation);
+
+      if (cost < cost_part || random.rand() < exp((cost_part - cost) / temperature)) {
+        particle.setCost(cost, violation);
+        particle.setBest();
+        particle.upSuccess(h);
+      } else {
+        particle[h] = x_part;
+        particle.setVelocity(h, v_part);
+        particle.setCost(cost_part, violation_part);
+        if (!evaluated) particle.setChanged();
+      }
 
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) { // loop on population
-    for (std::size_t h = 0; h < d; h++) { // loop on dimension
-      tmp = m_individuals[i];
-      tmp[h] += m_random.rand(-1., 1.) * m_individuals[i].getVelocity(h);
+    } else {
 
-      checkBoundary(tmp);
+      // The constraints may regenerate the whole point: the move is made
+      // on a copy of the particle
+      SAParticle& tmp = m_candidates[i];
+      tmp = particle;
+      tmp[h] += random.rand(-1., 1.) * particle.getVelocity(h);
+      checkBoundary(tmp, random);
 
-      evaluate(tmp);
-      cost_tmp = tmp.getCost();
-      cost_part = m_individuals[i].getCost();
+      cost = c.isEvaluated() ? evaluateCost(tmp.getPosition(), c.getPosition(), cost_part, violation) :
+      evaluateCost(tmp.getPosition(), violation);
+      tmp.setCost(cost, violation);
+      if (ckeckViolateConstraints(static_cast<const SAParticle&>(tmp).getPosition()) == false) tmp.setBest();
 
-      if (cost_tmp < cost_part){
-        m_individuals[i] = tmp;
-        m_individuals[i].upSuccess(h);
-      } else if (m_random.rand() < exp((cost_part - cost_tmp) / temperature)) {
-        m_individuals[i] = tmp;
-        m_individuals[i].upSuccess(h);
-      };
+      if (cost < cost_part || random.rand() < exp((cost_part - cost) / temperature)) {
+        std::swap(particle, tmp);
+        particle.upSuccess(h);
+      }
+
+    }
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void SAPopulation::updateTemperatures() {
+  double log_t = log(m_config.getT0());
+  for (std::size_t k = 0; k < m_replica.size(); ++k) {
+    m_temperature[m_replica[k]] = exp(log_t);
+    if (k < m_log_gap.size()) log_t += m_log_gap[k];
+  }
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
+void SAPopulation::exchangeReplicas() {
+  updateTemperatures();
+
+  // the pairs starting at the even and at the odd steps of the ladder
+  // are proposed in turn, so the swaps of a round are independent
+  for (std::size_t k = m_n_exchanges % 2; k + 1 < m_replica.size(); k += 2) {
+    std::size_t cold = m_replica[k];
+    std::size_t hot  = m_replica[k+1];
+    double delta = (m_individuals[cold].getCost() - m_individuals[hot].getCost()) *
+    (1. / m_temperature[cold] - 1. / m_temperature[hot]);
+
+    m_swap_attempts[k]++;
+    if (delta >= 0. || m_random.rand() < exp(delta)) {
+      std::swap(m_replica[k], m_replica[k+1]);
+      m_swap_accepted[k]++;
     }
   }
+  m_n_exchanges++;
+
+  updateTemperatures();
 }
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
+void SAPopulation::adaptLadder() {
+  std::size_t n_pairs = m_log_gap.size();
+  if (n_pairs < 2 || m_config.getTemperatureRatio() <= 1.) return;
+
+  // mean acceptance of the pairs for which swaps were proposed
+  double mean = 0.;
+  std::size_t n_proposed = 0;
+  for (std::size_t k = 0; k < n_pairs; ++k) {
+    if (m_swap_attempts[k] == 0) continue;
+    mean += (double) m_swap_accepted[k] / m_swap_attempts[k];
+    n_proposed++;
+  }
+  if (n_proposed == 0) return;
+  mean /= n_proposed;
+
+  // The gaps between the temperatures swapping more often than the average
+  // widen and the others shrink, so that the acceptance evens out along the
+  // ladder. The steps decrease with the adaptations and the ratio between
+  // the highest and the lowest temperature is kept.
+  double kappa = 1. / (1. + 0.1 * m_n_adaptations);
+  double sum = 0.;
+  for (std::size_t k = 0; k < n_pairs; ++k) {
+    double acceptance = m_swap_attempts[k] > 0 ? (double) m_swap_accepted[k] / m_swap_attempts[k] : mean;
+    m_log_gap[k] *= exp(kappa * (acceptance - mean));
+    sum += m_log_gap[k];
+    m_swap_attempts[k] = 0;
+    m_swap_accepted[k] = 0;
+  }
+  double scale = log(m_config.getTemperatureRatio()) / sum;
+  for (std::size_t k = 0; k < n_pairs; ++k) m_log_gap[k] *= scale;
+  m_n_adaptations++;
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 void SAPopulation::setVelocity() {
   std::size_t d = m_search_space.getNumberOfParameters();
   std::size_t Ns = m_config.getNs();
   std::size_t c = m_config.getC();
-  std::vector<std::size_t> success;
   double vel;
 
   for (std::size_t i = 0; i < m_individuals.size(); ++i) { // loop on population
-    success = m_individuals[i].getSuccess();
+    const std::vector<std::size_t>& success = m_individuals[i].getSuccess();
     for (std::size_t h = 0; h < d; h++) { // loop on dimension
       if (success[h] > 0.6 * Ns){
         vel = m_individuals[i].getVelocity(h) * (1. + c * ((((double) success[h]) / ((double) Ns)) - 0.6) / 0.4);
@@ -122,34 +249,33 @@ void SAPopulation::setVelocity() {
 
 }
 
+void SAPopulation::rank() {
+  EMIROOT_PROFILE(m_profiler, SORT);
+  m_order.set(m_individuals);
+  m_order.sort();
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+
 void SAPopulation::setStartingPoint(std::size_t iter) {
   std::size_t d = m_search_space.getNumberOfParameters();
   std::size_t n_pop = m_individuals.size();
   double w = m_config.getWmax() - ((double)iter / (double)m_config.getNMaxIterations()) * (m_config.getWmax() - m_config.getWmin());
 
   //select elite solutions by roulette wheel
+  const RouletteWheel& roulette = m_config.getRouletteWheel();
   for (std::size_t i = 0; i < n_pop; ++i) {
 
-    std::size_t elite1 = 0;
-    double ra1 = m_random.rand();
-    for (std::size_t u = 1; u < n_pop; u++) {
-      if (ra1 > m_config.getProb(u - 1) && ra1 <= m_config.getProb(u)) elite1 = u;
-    };
-
-    std::size_t elite2 = 0;
-    double ra2 = m_random.rand();
-    for (std::size_t u = 1; u < n_pop; u++) {
-      if (ra2 > m_config.getProb(u - 1) && ra2 <= m_config.getProb(u)) elite2 = u;
-    };
+    const SAParticle& elite1 = m_individuals[m_order[roulette.select(m_random.rand())]];
+    const SAParticle& elite2 = m_individuals[m_order[roulette.select(m_random.rand())]];
 
     //set initial point on the basis of the current position and elite best position
     for (std::size_t j = 0; j < d; ++j) {
       double ra3 = m_random.rand();
       double ra4 = m_random.rand();
 
-      double best_position = m_individuals[j].getBestPositionComponent(j);
-      m_individuals[i][j] = best_position + w * (ra3 * (m_individuals[elite1].getBestPositionComponent(j) - best_position)
-      + ra4 * (m_individuals[elite2].getBestPositionComponent(j) - best_position));
+      double best_position = m_individuals[i].getBestPositionComponent(j);
+      m_individuals[i][j] = best_position + w * (ra3 * (elite1.getBestPositionComponent(j) - best_position)
+      + ra4 * (elite2.getBestPositionComponent(j) - best_position));
 
     }
     checkBoundary(m_individuals[i]);
@@ -158,29 +284,12 @@ void SAPopulation::setStartingPoint(std::size_t iter) {
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
-void SAPopulation::sort() {
-  std::sort(m_individuals.begin(), m_individuals.end());
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-void SAPopulation::evaluate() {
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-    evaluate(m_individuals[i]);
-  }
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-void SAPopulation::evaluate(SAParticle& solution) {
-  double value = evaluateCost(solution.getPosition());
-  solution.setCost(value);
-
-  if (ckeckViolateConstraints(solution.getPosition()) == false) {
+void SAPopulation::track(SAParticle& solution) {
+  if (ckeckViolateConstraints(static_cast<const SAParticle&>(solution).getPosition()) == false) {
     solution.setBest();
     if (solution.getCost() < m_best_solution.getCost()){
       m_best_solution = solution;
     };
   };
-
 }
-
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
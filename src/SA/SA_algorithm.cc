@@ -20,107 +20,46 @@
 
 using namespace EmiROOT;
 
-SA_algorithm::SA_algorithm(const Function& obj_function, const SAConfig& config) :
-Algorithm(obj_function),
-m_population(SAPopulation(obj_function)) {
-  m_algo_config = config;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
+template class EmiROOT::AlgorithmBase<SA_algorithm, SAPopulation, SAConfig>;
 
-void SA_algorithm::setSeed(uint64_t t_seed) {
-  m_search_space.setSeed(t_seed);
-  m_population.setSeed(t_seed);
-}
+SA_algorithm::SA_algorithm(const Function& obj_function, const SAConfig& config) :
+AlgorithmBase<SA_algorithm, SAPopulation, SAConfig>(obj_function, config) {}
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
-void SA_algorithm::minimize() {
-  m_iter = 0;
-  std::size_t n_iter = m_algo_config.getNMaxIterations();
-  double tolerance = m_algo_config.getAbsoluteTol();
-
-  // Initialization of the population
-  m_population.setConfig(m_algo_config);
-  m_population.setSearchSpace(m_search_space);
-  m_population.setConstraints(m_constraints);
-  m_population.setConstrainedMethod(m_constrained_method);
-  m_population.setPenaltyScaling(m_penalty_scaling);
-  m_population.setStartPenaltyCoeff(m_start_penalty_param);
-  m_population.setMaxPenaltyCoeff(m_max_penalty_param);
-  m_population.setOOB(m_oob_sol);
-  m_population.setMaximization(m_maximize);
-  m_population.setInitialPopulation(m_initial_population);
-  m_population.setSilent(m_silent);
-  m_population.init();
-
-  // Initialize the progress bar
-  m_progress_bar.clear();
-
+void SA_algorithm::initialize() {
   // Evaluate the cost for the population
   m_population.evaluate();
 
-  m_population.setStartingPoint(0);
-
-  // Update the cost history
-  double current_best_cost = m_maximize ? -m_population.getBestSolution()->getCost() : m_population.getBestSolution()->getCost();
-  m_cost_history.resize(n_iter);
-  m_cost_history[0] = current_best_cost;
-
-  // Update the population position history
-  if (m_save_population) addPopulationPosition(m_population.getPopulationPosition());
+  m_population.rank();
 
-  double Rt = m_algo_config.getRt();
-
-  // Check if it is necessary to control the number of iterations at the same cost
-  bool do_check_same_cost = false;
-  if (n_iter > m_algo_config.getNMaxIterationsSameCost()) do_check_same_cost = true;
+  // In the replica exchange mode each replica keeps its own chain
+  if (!m_algo_config.isReplicaExchange()) m_population.setStartingPoint(0);
+}
+//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
-  std::size_t n_sc = 0;
-  for (m_iter = 1; m_iter < n_iter; ++m_iter) { //Every iteration is a change of temperature
-    // scale the penalty coefficient for
-    // constrained optimization
-    m_population.scalePenaltyCoeff();
+void SA_algorithm::step() {
+  // Every iteration is a change of temperature
+  bool replica_exchange = m_algo_config.isReplicaExchange();
+  for (std::size_t m = 0; m < m_algo_config.getNt(); m++){
+    for (std::size_t j = 0; j < m_algo_config.getNs(); j++){
+      m_population.move();
 
-    for (std::size_t m = 0; m < m_algo_config.getNt(); m++){
-      for (std::size_t j = 0; j < m_algo_config.getNs(); j++){
-        m_population.move();
-      }
-      // Update the step vector
-      m_population.setVelocity();
+      // Swap the replicas at neighbouring temperatures
+      if (replica_exchange) m_population.exchangeReplicas();
     }
+    // Update the step vector
+    m_population.setVelocity();
 
-    // Update the temperature
-    m_population.getConfig().setT0(m_population.getConfig().getT0() * Rt);
-
-    m_population.sort();
-
-    m_population.setStartingPoint(m_iter);
-
-    // Update the cost history
-    current_best_cost = m_maximize ? -m_population.getBestSolution()->getCost() : m_population.getBestSolution()->getCost();
-    m_cost_history[m_iter] = current_best_cost;
+    // Space the temperatures to even out the swaps
+    if (replica_exchange) m_population.adaptLadder();
+  }
 
-    // Update the population position history
-    if (m_save_population) addPopulationPosition(m_population.getPopulationPosition());
+  // Update the temperature (the lowest one of the ladder in the replica
+  // exchange mode, which is shifted as a whole)
+  m_population.getConfig().setT0(m_population.getConfig().getT0() * m_algo_config.getRt());
 
-    // Check on same cost iterations
-    if (do_check_same_cost) {
-      if (m_iter > 0 && tolerance == 0 && Utility::areEqual(m_cost_history[m_iter-1], m_cost_history[m_iter], 2) ) { //check machine defined precision
-        n_sc++;
-      } else if (m_iter > 0 && tolerance != 0 && (m_cost_history[m_iter-1] - m_cost_history[m_iter]) < tolerance) { //check using user defined precision
-        n_sc++;
-      }  else {
-        n_sc = 0;
-      };
-      if (n_sc > m_algo_config.getNMaxIterationsSameCost()) {
-        m_cost_history.resize(m_iter+1);
-        break;
-      }
-    }
-
-    // Update progress bar
-    if (!m_silent && m_iter % 10 == 0) m_progress_bar.update(100.*m_iter/n_iter);
-  }
+  m_population.rank();
 
-  m_population_base = &m_population;
+  if (!replica_exchange) m_population.setStartingPoint(m_iter);
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
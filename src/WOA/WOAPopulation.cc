@@ -17,10 +17,11 @@
 
 
 #include <WOA/WOAPopulation.h>
+#include <Base/Kernels.h>
 
 using namespace EmiROOT;
 
-WOAPopulation::WOAPopulation(Function func) : Population(func) {
+WOAPopulation::WOAPopulation(Function func) : PopulationBase(func) {
   m_a = 0.;
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
@@ -31,17 +32,14 @@ void WOAPopulation::init() {
   std::size_t d = m_search_space.getNumberOfParameters();
   m_individuals.resize(pop_size, Whale(d));
 
-  if (m_initial_population.size() > 0) {
+  // Load the positions provided by the user, if any
+  std::size_t n_loaded = loadInitialPopulation();
 
-    // Load the positions provided by the user
-    for (std::size_t i = 0; i < (std::size_t) m_initial_population.size(); ++i) {
-      m_individuals[i].setPosition(m_initial_population[i]);
-    }
-  } else {
+  if (n_loaded < m_individuals.size()) {
 
-    // Generate randomly the position of the individuals
+    // Generate randomly the position of the other individuals
     if (!m_silent) std::cout << "Generating the initial population...\n";
-    for (std::size_t i = 0; i < m_individuals.size(); ++i) {
+    for (std::size_t i = n_loaded; i < m_individuals.size(); ++i) {
       m_individuals[i].setPosition(m_search_space.getRandom());
     }
 
@@ -54,26 +52,6 @@ void WOAPopulation::init() {
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
 
 
-void WOAPopulation::setConfig(const WOAConfig& t_config) {
-  m_config = t_config;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-std::vector<std::vector<double> > WOAPopulation::getPopulationPosition() {
-  std::vector<std::vector<double> > positions(m_individuals.size());
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) positions[i] = m_individuals[i].getPosition();
-  return positions;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-Whale* WOAPopulation::getBestSolution() {
-  return &m_best_solution;
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
 void WOAPopulation::updateParameters(std::size_t t) {
   m_a  = 2. - t*(2./m_config.getNMaxIterations());
   m_a2 = -1. + t*((-1.)/m_config.getNMaxIterations());
@@ -82,8 +60,11 @@ void WOAPopulation::updateParameters(std::size_t t) {
 
 
 void WOAPopulation::moveWhales() {
-  double r1, r2, A, C, b, l, rw, p, D_tmp, D_best, distance;
-  Whale tmp;
+  double r1, r2, A, C, b, l, p;
+  std::size_t rw;
+  std::size_t d = m_search_space.getNumberOfParameters();
+  const Point& best = static_cast<const Whale&>(m_best_solution).getPosition();
+
   // Loop on the population of whales
   for (std::size_t i = 0; i < m_individuals.size(); ++i) {
 
@@ -95,29 +76,25 @@ void WOAPopulation::moveWhales() {
     l  = (m_a2-1)*m_random.rand()+1;
     p  = m_random.rand();
 
-    // Loop on dimension
-    for (std::size_t j = 0; j < m_individuals[0].getDimension(); ++j) {
+    Point& x = m_individuals[i].getPosition();
+    if (p < 0.5) {
 
-      if (p < 0.5) {
-
-        if (fabs(A) >= 1) {
-          // random whale
-          rw             = m_random.randUInt(0, m_individuals.size());
-          tmp            = m_individuals[rw];
-          D_tmp          = fabs(C*tmp[j] - m_individuals[i][j]);
-          m_individuals[i][j] = tmp[j] - A*D_tmp;
-
-        } else {
-          // encircling prey
-          D_best         = fabs(C*m_best_solution[j] - m_individuals[i][j]);
-          m_individuals[i][j] = m_best_solution[j]-A*D_best;
+      if (fabs(A) >= 1) {
+        // random whale, drawn for each coordinate
+        for (std::size_t j = 0; j < d; ++j) {
+          rw = m_random.randUInt(0, m_individuals.size());
+          const Whale& random_whale = m_individuals[rw];
+          x[j] = random_whale[j] - A*fabs(C*random_whale[j] - x[j]);
         }
 
       } else {
-        // distance whale to the prey
-        distance       = fabs(m_best_solution[j] - m_individuals[i][j]);
-        m_individuals[i][j] = distance*exp(b*l)*cos(l*2*M_PI) + m_best_solution[j];
+        // encircling prey
+        Kernels::encircle(x.data(), best.data(), A, C, d);
       }
+
+    } else {
+      // spiral around the prey, with the same factor for all coordinates
+      Kernels::spiral(x.data(), best.data(), exp(b*l)*cos(l*2*M_PI), d);
     }
 
     // boundary check
@@ -125,24 +102,3 @@ void WOAPopulation::moveWhales() {
   }
 }
 //_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void WOAPopulation::evaluate() {
-  for (std::size_t i = 0; i < m_individuals.size(); ++i) {
-    evaluate(m_individuals[i]);
-  }
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/
-
-
-void WOAPopulation::evaluate(Whale& solution) {
-  double value = evaluateCost(solution.getPosition());
-  solution.setCost(value);
-
-  if (value < m_best_solution.getCost()) {
-    if (ckeckViolateConstraints(solution.getPosition()) == false) {
-      m_best_solution = solution;
-    }
-  };
-}
-//_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/_/